@@ -20,6 +20,7 @@
 #include <sstream>
 #include <vector>
 #include <unordered_map>
+#include <atomic>
 #include <cstdint>
 #include "cpprest/details/basic_types.h"
 #include "cpprest/asyncrt_utils.h"
@@ -64,6 +65,7 @@ namespace json
     class number;
     class array;
     class object;
+    class json_writer;
 
     /// <summary>
     /// A JSON value represented as a C++ class.
@@ -628,6 +630,7 @@ public:
     private:
         friend class web::json::details::_Object;
         friend class web::json::details::_Array;
+        friend class web::json::json_writer;
         template<typename CharType> friend class web::json::details::JSON_Parser;
 
 #ifdef _WIN32
@@ -947,6 +950,12 @@ public:
     /// <summary>
     /// A JSON object represented as a C++ class.
     /// </summary>
+    /// <remarks>
+    /// Objects that preserve the order of their fields build a hash index from key to position
+    /// on the first lookup once they grow beyond a small number of fields, so lookups stay constant
+    /// time. The index is maintained by the member functions of this class; field names must not be
+    /// modified through iterators.
+    /// </remarks>
     class object
     {
         typedef std::vector<std::pair<utility::string_t, json::value>> storage_type;
@@ -959,8 +968,8 @@ public:
         typedef storage_type::size_type size_type;
 
     private:
-        object(bool keep_order = false) : m_elements(), m_keep_order(keep_order) { }
-        object(storage_type elements, bool keep_order = false) : m_elements(std::move(elements)), m_keep_order(keep_order)
+        object(bool keep_order = false) : m_elements(), m_keep_order(keep_order), m_index(nullptr) { }
+        object(storage_type elements, bool keep_order = false) : m_elements(std::move(elements)), m_keep_order(keep_order), m_index(nullptr)
         {
             if (!keep_order) {
                 sort(m_elements.begin(), m_elements.end(), compare_pairs);
@@ -968,6 +977,59 @@ public:
         }
 
     public:
+        /// <summary>
+        /// Copy constructor
+        /// </summary>
+        object(const object &other)
+            : m_elements(other.m_elements),
+              m_keep_order(other.m_keep_order),
+              m_index(nullptr)
+        { }
+
+        /// <summary>
+        /// Move constructor
+        /// </summary>
+        object(object &&other) CPPREST_NOEXCEPT
+            : m_elements(std::move(other.m_elements)),
+              m_keep_order(other.m_keep_order),
+              m_index(other.m_index.exchange(nullptr))
+        { }
+
+        /// <summary>
+        /// Destructor
+        /// </summary>
+        ~object()
+        {
+            delete m_index.load();
+        }
+
+        /// <summary>
+        /// Assignment operator.
+        /// </summary>
+        object &operator=(const object &other)
+        {
+            if (this != &other)
+            {
+                object temp(other);
+                *this = std::move(temp);
+            }
+            return *this;
+        }
+
+        /// <summary>
+        /// Move assignment operator.
+        /// </summary>
+        object &operator=(object &&other) CPPREST_NOEXCEPT
+        {
+            if (this != &other)
+            {
+                m_elements = std::move(other.m_elements);
+                m_keep_order = other.m_keep_order;
+                delete m_index.exchange(other.m_index.exchange(nullptr));
+            }
+            return *this;
+        }
+
         /// <summary>
         /// Gets the beginning iterator element of the object
         /// </summary>
@@ -1084,6 +1146,7 @@ public:
         /// <remarks>GCC doesn't support erase with const_iterator on vector yet. In the future this should be changed.</remarks>
         iterator erase(iterator position)
         {
+            unindex(static_cast<size_type>(position - m_elements.begin()));
             return m_elements.erase(position);
         }
 
@@ -1099,6 +1162,7 @@ public:
                 throw web::json::json_exception(_XPLATSTR("Key not found"));
             }
 
+            unindex(static_cast<size_type>(iter - m_elements.begin()));
             m_elements.erase(iter);
         }
 
@@ -1145,7 +1209,14 @@ public:
 
             if (iter == m_elements.end() || key != iter->first)
             {
-                return m_elements.insert(iter, std::pair<utility::string_t, value>(key, value()))->second;
+                iter = m_elements.insert(iter, std::pair<utility::string_t, value>(key, value()));
+                auto index = m_index.load(std::memory_order_relaxed);
+                if (index != nullptr)
+                {
+                    // Only ordered objects have an index, and they always append, so existing positions are unaffected.
+                    index->emplace(key, m_elements.size() - 1);
+                }
+                return iter->second;
             }
 
             return iter->second;
@@ -1189,9 +1260,80 @@ public:
             return p1.first < key;
         }
 
+        typedef std::unordered_map<utility::string_t, size_type> index_type;
+
+        // Number of fields above which an ordered object builds a hash index.
+        static const size_type index_threshold = 32;
+
+        // Gets the key to position index, building it first if this is a large ordered object.
+        const index_type *lookup_index() const
+        {
+            auto index = m_index.load(std::memory_order_acquire);
+            if (index != nullptr || !m_keep_order || m_elements.size() <= index_threshold)
+            {
+                return index;
+            }
+
+            auto built = utility::details::make_unique<index_type>(m_elements.size());
+            for (size_type i = 0; i < m_elements.size(); ++i)
+            {
+                // Keep the first occurrence of a duplicate key, the same field a linear search finds.
+                built->emplace(m_elements[i].first, i);
+            }
+
+            // Lookups on a const object may race to build the index, the first one to finish publishes it.
+            if (m_index.compare_exchange_strong(index, built.get(), std::memory_order_acq_rel))
+            {
+                index = built.release();
+            }
+            return index;
+        }
+
+        // Updates the index for the removal of the field at position pos.
+        void unindex(size_type pos)
+        {
+            auto index = m_index.load(std::memory_order_relaxed);
+            if (index == nullptr)
+            {
+                return;
+            }
+
+            const auto &key = m_elements[pos].first;
+            auto found = index->find(key);
+            for (auto &entry : *index)
+            {
+                if (entry.second > pos)
+                {
+                    --entry.second;
+                }
+            }
+
+            if (found != index->end() && found->second == pos)
+            {
+                // A later field with the same key, which only parsing can produce, becomes the one lookups find.
+                auto duplicate = std::find_if(m_elements.begin() + pos + 1, m_elements.end(),
+                    [&key](const std::pair<utility::string_t, value>& p) {
+                    return p.first == key;
+                });
+                if (duplicate == m_elements.end())
+                {
+                    index->erase(found);
+                }
+                else
+                {
+                    found->second = static_cast<size_type>(duplicate - m_elements.begin()) - 1;
+                }
+            }
+        }
+
         storage_type::iterator find_insert_location(const utility::string_t &key)
         {
-            if (m_keep_order)
+            if (auto index = lookup_index())
+            {
+                auto found = index->find(key);
+                return found == index->end() ? m_elements.end() : m_elements.begin() + found->second;
+            }
+            else if (m_keep_order)
             {
                 return std::find_if(m_elements.begin(), m_elements.end(),
                     [&key](const std::pair<utility::string_t, value>& p) {
@@ -1206,7 +1348,12 @@ public:
 
         storage_type::const_iterator find_by_key(const utility::string_t& key) const
         {
-            if (m_keep_order)
+            if (auto index = lookup_index())
+            {
+                auto found = index->find(key);
+                return found == index->end() ? m_elements.cend() : m_elements.cbegin() + found->second;
+            }
+            else if (m_keep_order)
             {
                 return std::find_if(m_elements.begin(), m_elements.end(),
                     [&key](const std::pair<utility::string_t, value>& p) {
@@ -1236,6 +1383,7 @@ public:
 
         storage_type m_elements;
         bool m_keep_order;
+        mutable std::atomic<index_type *> m_index;
         friend class details::_Object;
 
         template<typename CharType> friend class json::details::JSON_Parser;
@@ -0,0 +1,512 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* HTTP Library: Binding of JSON to C++ types
+*
+* For the latest on this and related APIs, please see: https://github.com/Microsoft/cpprestsdk
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+#pragma once
+
+#ifndef _CASA_JSON_BINDING_H
+#define _CASA_JSON_BINDING_H
+
+#include <limits>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+#include "cpprest/json.h"
+#include "cpprest/json_reader.h"
+#include "cpprest/json_writer.h"
+
+// A type is bound to JSON by declaring its fields once in a member function template:
+//
+//     struct person
+//     {
+//         utility::string_t name;
+//         int age;
+//         std::vector<utility::string_t> emails;
+//
+//         template <typename Binder>
+//         void json_fields(Binder &binder)
+//         {
+//             binder.field(U("name"), name);
+//             binder.field(U("age"), age);
+//             binder.field(U("emails"), emails);
+//         }
+//     };
+//
+// The binding supports bool, the arithmetic types, utility::string_t, json::value, std::vector
+// of any supported type and other bound types. Members missing from the JSON keep their value,
+// unknown members are ignored and values of the wrong type throw a json_exception.
+
+namespace web
+{
+namespace json
+{
+namespace details
+{
+    inline void _throw_binding_error(const utility::char_t *message)
+    {
+        throw json_exception(message);
+    }
+
+    template <typename T>
+    T _checked_integer(int64_t val)
+    {
+        if (std::numeric_limits<T>::is_signed
+            ? (val < static_cast<int64_t>(std::numeric_limits<T>::min()) || val > static_cast<int64_t>(std::numeric_limits<T>::max()))
+            : (val < 0 || static_cast<uint64_t>(val) > static_cast<uint64_t>(std::numeric_limits<T>::max())))
+        {
+            _throw_binding_error(_XPLATSTR("Integer is out of range"));
+        }
+        return static_cast<T>(val);
+    }
+
+    template <typename T>
+    T _checked_integer(uint64_t val)
+    {
+        if (val > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+        {
+            _throw_binding_error(_XPLATSTR("Integer is out of range"));
+        }
+        return static_cast<T>(val);
+    }
+
+    //
+    // Binding from json::value
+    //
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value>::type _bind_from_value(const json::value &val, T &target)
+    {
+        const auto &num = val.as_number();
+        if (!num.is_integral())
+        {
+            _throw_binding_error(_XPLATSTR("Expected an integer"));
+        }
+        target = num.is_int64() ? _checked_integer<T>(num.to_int64()) : _checked_integer<T>(num.to_uint64());
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type _bind_from_value(const json::value &val, T &target)
+    {
+        target = static_cast<T>(val.as_double());
+    }
+
+    inline void _bind_from_value(const json::value &val, bool &target)
+    {
+        target = val.as_bool();
+    }
+
+    inline void _bind_from_value(const json::value &val, utility::string_t &target)
+    {
+        target = val.as_string();
+    }
+
+    inline void _bind_from_value(const json::value &val, json::value &target)
+    {
+        target = val;
+    }
+
+    template <typename T>
+    void _bind_from_value(const json::value &val, std::vector<T> &target);
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value>::type _bind_from_value(const json::value &val, T &target);
+
+    class _value_reader
+    {
+    public:
+        explicit _value_reader(const json::object &obj) : m_object(obj) {}
+
+        template <typename T>
+        void field(const utility::char_t *name, T &target)
+        {
+            auto iter = m_object.find(name);
+            if (iter != m_object.end())
+            {
+                _bind_from_value(iter->second, target);
+            }
+        }
+
+    private:
+        _value_reader &operator=(const _value_reader &);
+        const json::object &m_object;
+    };
+
+    template <typename T>
+    void _bind_from_value(const json::value &val, std::vector<T> &target)
+    {
+        const auto &arr = val.as_array();
+        target.clear();
+        target.reserve(arr.size());
+        for (const auto &element : arr)
+        {
+            T item;
+            _bind_from_value(element, item);
+            target.push_back(std::move(item));
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value>::type _bind_from_value(const json::value &val, T &target)
+    {
+        _value_reader binder(val.as_object());
+        target.json_fields(binder);
+    }
+
+    //
+    // Binding to json::value
+    //
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, json::value>::type _bind_to_value(const T &source)
+    {
+        return json::value::number(static_cast<int64_t>(source));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, json::value>::type _bind_to_value(const T &source)
+    {
+        return json::value::number(static_cast<uint64_t>(source));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, json::value>::type _bind_to_value(const T &source)
+    {
+        return json::value::number(static_cast<double>(source));
+    }
+
+    inline json::value _bind_to_value(const bool &source)
+    {
+        return json::value::boolean(source);
+    }
+
+    inline json::value _bind_to_value(const utility::string_t &source)
+    {
+        return json::value::string(source);
+    }
+
+    inline json::value _bind_to_value(const json::value &source)
+    {
+        return source;
+    }
+
+    template <typename T>
+    json::value _bind_to_value(const std::vector<T> &source);
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value, json::value>::type _bind_to_value(const T &source);
+
+    class _value_writer
+    {
+    public:
+        explicit _value_writer(std::vector<std::pair<utility::string_t, json::value>> &fields) : m_fields(fields) {}
+
+        template <typename T>
+        void field(const utility::char_t *name, const T &source)
+        {
+            m_fields.emplace_back(name, _bind_to_value(source));
+        }
+
+    private:
+        _value_writer &operator=(const _value_writer &);
+        std::vector<std::pair<utility::string_t, json::value>> &m_fields;
+    };
+
+    template <typename T>
+    json::value _bind_to_value(const std::vector<T> &source)
+    {
+        std::vector<json::value> elements;
+        elements.reserve(source.size());
+        for (const auto &element : source)
+        {
+            elements.push_back(_bind_to_value(element));
+        }
+        return json::value::array(std::move(elements));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value, json::value>::type _bind_to_value(const T &source)
+    {
+        std::vector<std::pair<utility::string_t, json::value>> fields;
+        _value_writer binder(fields);
+        // The writer only reads the fields, json_fields is non-const so that one declaration serves both directions.
+        const_cast<T &>(source).json_fields(binder);
+        return json::value::object(std::move(fields), true);
+    }
+
+    //
+    // Binding from a json_reader
+    //
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value>::type _bind_from_reader(json_reader &reader, T &target)
+    {
+        if (reader.kind() != json_reader::integer_value)
+        {
+            reader.fail(_XPLATSTR("Expected an integer"));
+        }
+        target = reader.is_signed() ? _checked_integer<T>(reader.as_int64()) : _checked_integer<T>(reader.as_uint64());
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type _bind_from_reader(json_reader &reader, T &target)
+    {
+        if (reader.kind() != json_reader::integer_value && reader.kind() != json_reader::number_value)
+        {
+            reader.fail(_XPLATSTR("Expected a number"));
+        }
+        target = static_cast<T>(reader.as_double());
+    }
+
+    inline void _bind_from_reader(json_reader &reader, bool &target)
+    {
+        if (reader.kind() != json_reader::boolean_value)
+        {
+            reader.fail(_XPLATSTR("Expected a boolean"));
+        }
+        target = reader.as_bool();
+    }
+
+    inline void _bind_from_reader(json_reader &reader, utility::string_t &target)
+    {
+        if (reader.kind() != json_reader::string_value)
+        {
+            reader.fail(_XPLATSTR("Expected a string"));
+        }
+        target = reader.text();
+    }
+
+    _ASYNCRTIMP void _bind_from_reader(json_reader &reader, json::value &target);
+
+    template <typename T>
+    void _bind_from_reader(json_reader &reader, std::vector<T> &target);
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value>::type _bind_from_reader(json_reader &reader, T &target);
+
+    class _token_reader
+    {
+    public:
+        explicit _token_reader(json_reader &reader) : m_reader(reader), m_matched(false) {}
+
+        template <typename T>
+        void field(const utility::char_t *name, T &target)
+        {
+            if (!m_matched && m_reader.text() == name)
+            {
+                m_matched = true;
+                m_reader.read();
+                _bind_from_reader(m_reader, target);
+            }
+        }
+
+        bool matched() const { return m_matched; }
+
+    private:
+        _token_reader &operator=(const _token_reader &);
+        json_reader &m_reader;
+        bool m_matched;
+    };
+
+    template <typename T>
+    void _bind_from_reader(json_reader &reader, std::vector<T> &target)
+    {
+        if (reader.kind() != json_reader::begin_array)
+        {
+            reader.fail(_XPLATSTR("Expected an array"));
+        }
+        target.clear();
+        while (reader.read() != json_reader::end_array)
+        {
+            T item;
+            _bind_from_reader(reader, item);
+            target.push_back(std::move(item));
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value>::type _bind_from_reader(json_reader &reader, T &target)
+    {
+        if (reader.kind() != json_reader::begin_object)
+        {
+            reader.fail(_XPLATSTR("Expected an object"));
+        }
+        while (reader.read() != json_reader::end_object)
+        {
+            _token_reader binder(reader);
+            target.json_fields(binder);
+            if (!binder.matched())
+            {
+                reader.read();
+                reader.skip();
+            }
+        }
+    }
+
+    //
+    // Binding to a json_writer
+    //
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type _bind_to_writer(json_writer &writer, const T &source)
+    {
+        writer.number(static_cast<int64_t>(source));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type _bind_to_writer(json_writer &writer, const T &source)
+    {
+        writer.number(static_cast<uint64_t>(source));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type _bind_to_writer(json_writer &writer, const T &source)
+    {
+        writer.number(static_cast<double>(source));
+    }
+
+    inline void _bind_to_writer(json_writer &writer, const bool &source)
+    {
+        writer.boolean(source);
+    }
+
+    inline void _bind_to_writer(json_writer &writer, const utility::string_t &source)
+    {
+        writer.string(source);
+    }
+
+    inline void _bind_to_writer(json_writer &writer, const json::value &source)
+    {
+        writer.write(source);
+    }
+
+    template <typename T>
+    void _bind_to_writer(json_writer &writer, const std::vector<T> &source);
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value>::type _bind_to_writer(json_writer &writer, const T &source);
+
+    class _token_writer
+    {
+    public:
+        explicit _token_writer(json_writer &writer) : m_writer(writer) {}
+
+        template <typename T>
+        void field(const utility::char_t *name, const T &source)
+        {
+            m_writer.key(name);
+            _bind_to_writer(m_writer, source);
+        }
+
+    private:
+        _token_writer &operator=(const _token_writer &);
+        json_writer &m_writer;
+    };
+
+    template <typename T>
+    void _bind_to_writer(json_writer &writer, const std::vector<T> &source)
+    {
+        writer.begin_array();
+        for (const auto &element : source)
+        {
+            _bind_to_writer(writer, element);
+        }
+        writer.end_array();
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value>::type _bind_to_writer(json_writer &writer, const T &source)
+    {
+        writer.begin_object();
+        _token_writer binder(writer);
+        const_cast<T &>(source).json_fields(binder);
+        writer.end_object();
+    }
+}
+
+    /// <summary>
+    /// Assigns the members of a bound type from a JSON value.
+    /// </summary>
+    /// <param name="val">The JSON value, an object for bound types.</param>
+    /// <param name="target">The object to assign to.</param>
+    template <typename T>
+    void from_json(const json::value &val, T &target)
+    {
+        details::_bind_from_value(val, target);
+    }
+
+    /// <summary>
+    /// Converts a bound type to a JSON value. Object members appear in the order the fields are declared.
+    /// </summary>
+    /// <param name="source">The object to convert.</param>
+    /// <returns>The JSON value.</returns>
+    template <typename T>
+    json::value to_json(const T &source)
+    {
+        return details::_bind_to_value(source);
+    }
+
+    /// <summary>
+    /// Assigns the members of a bound type from the value starting at the current token of a reader,
+    /// leaving the reader at the last token of the value.
+    /// </summary>
+    /// <param name="reader">The reader, positioned at the first token of the value.</param>
+    /// <param name="target">The object to assign to.</param>
+    template <typename T>
+    void read_json(json_reader &reader, T &target)
+    {
+        details::_bind_from_reader(reader, target);
+    }
+
+    /// <summary>
+    /// Parses JSON text straight into a bound type, without building intermediate JSON values.
+    /// </summary>
+    /// <param name="text">The JSON text.</param>
+    /// <param name="target">The object to assign to.</param>
+    template <typename T>
+    void parse_json(const utility::string_t &text, T &target)
+    {
+        json_reader reader(text);
+        reader.read();
+        details::_bind_from_reader(reader, target);
+        reader.read();
+    }
+
+    /// <summary>
+    /// Writes a bound type to a JSON writer.
+    /// </summary>
+    /// <param name="writer">The writer.</param>
+    /// <param name="source">The object to write.</param>
+    template <typename T>
+    void write_json(json_writer &writer, const T &source)
+    {
+        details::_bind_to_writer(writer, source);
+    }
+
+    /// <summary>
+    /// Serializes a bound type straight to UTF-8 JSON text, without building intermediate JSON values.
+    /// </summary>
+    /// <param name="source">The object to serialize.</param>
+    /// <returns>The JSON text.</returns>
+    template <typename T>
+    std::string serialize_json(const T &source)
+    {
+        std::ostringstream stream;
+        {
+            json_writer writer(stream);
+            details::_bind_to_writer(writer, source);
+            writer.flush().wait();
+        }
+        return stream.str();
+    }
+
+}} // namespace web::json
+
+#endif
@@ -0,0 +1,106 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* HTTP Library: Newline delimited JSON (NDJSON) reader
+*
+* For the latest on this and related APIs, please see: https://github.com/Microsoft/cpprestsdk
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+#pragma once
+
+#ifndef _CASA_JSON_NDJSON_H
+#define _CASA_JSON_NDJSON_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include "cpprest/json.h"
+#include "cpprest/streams.h"
+
+namespace web
+{
+namespace json
+{
+    namespace details
+    {
+        class _ndjson_reader_impl;
+    }
+
+    /// <summary>
+    /// A batch of consecutive records read from a newline delimited JSON stream.
+    /// </summary>
+    struct ndjson_batch
+    {
+        ndjson_batch() : sequence(0) { }
+
+        /// <summary>
+        /// The position of the batch in the input, starting at zero.
+        /// </summary>
+        size_t sequence;
+
+        /// <summary>
+        /// The parsed records, one for each non-blank line of the batch.
+        /// </summary>
+        std::vector<json::value> records;
+    };
+
+    /// <summary>
+    /// Reads newline delimited JSON (NDJSON) from an asynchronous stream. The input is split into
+    /// batches of whole lines which are parsed in parallel on the task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// Splitting the input happens sequentially as data arrives, while up to <c>max_parallel_batches</c>
+    /// batches are parsed concurrently. Batches are handed out through <c>move_next</c> and <c>current</c>
+    /// without copying the parsed values. Only one call to <c>move_next</c> may be outstanding at a time.
+    /// </remarks>
+    class ndjson_reader
+    {
+    public:
+        /// <summary>
+        /// The default number of bytes of input collected into a single batch.
+        /// </summary>
+        static const size_t default_batch_size = 1024 * 1024;
+
+        /// <summary>
+        /// Creates a reader over a UTF-8 encoded input stream.
+        /// </summary>
+        /// <param name="input">The stream to read from.</param>
+        /// <param name="ordered">If <c>true</c> batches are delivered in input order, otherwise as soon as they are parsed.</param>
+        /// <param name="batch_size">The number of bytes of input collected into a batch, batches always end at a line break.</param>
+        /// <param name="max_parallel_batches">The number of batches parsed concurrently, zero uses the number of hardware threads.</param>
+        _ASYNCRTIMP ndjson_reader(concurrency::streams::istream input, bool ordered = true, size_t batch_size = default_batch_size, size_t max_parallel_batches = 0);
+
+        /// <summary>
+        /// Advances the reader to the next batch of records.
+        /// </summary>
+        /// <returns>
+        /// A task that completes with <c>true</c> if a batch is available through <c>current</c>, or
+        /// <c>false</c> once the input has been consumed.
+        /// </returns>
+        /// <remarks>If a line fails to parse the task completes with a <see cref="json_exception"/>.</remarks>
+        _ASYNCRTIMP pplx::task<bool> move_next();
+
+        /// <summary>
+        /// Gets the batch the reader is positioned on after <c>move_next</c> completed with <c>true</c>.
+        /// </summary>
+        /// <returns>The current batch, its records may be moved out by the caller.</returns>
+        _ASYNCRTIMP ndjson_batch &current();
+
+        /// <summary>
+        /// Reads all remaining batches, passing each to a callback in the order they are delivered.
+        /// </summary>
+        /// <param name="handler">The callback which receives each batch.</param>
+        /// <returns>A task that completes once the input has been consumed.</returns>
+        _ASYNCRTIMP pplx::task<void> for_each(std::function<void(ndjson_batch &)> handler);
+
+    private:
+        std::shared_ptr<details::_ndjson_reader_impl> m_impl;
+    };
+
+}} // namespace web::json
+
+#endif
@@ -0,0 +1,135 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* HTTP Library: JSON Pointer (RFC 6901) and JSONPath queries over JSON values
+*
+* For the latest on this and related APIs, please see: https://github.com/Microsoft/cpprestsdk
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+#pragma once
+
+#ifndef _CASA_JSON_POINTER_H
+#define _CASA_JSON_POINTER_H
+
+#include <vector>
+#include "cpprest/json.h"
+
+namespace web
+{
+namespace json
+{
+    /// <summary>
+    /// A JSON Pointer as defined by RFC 6901, such as <c>/items/0/name</c>. The pointer is parsed once
+    /// and can then be evaluated against any number of JSON values without copying them.
+    /// </summary>
+    class json_pointer
+    {
+    public:
+        /// <summary>
+        /// Creates a pointer that refers to the whole document.
+        /// </summary>
+        _ASYNCRTIMP json_pointer();
+
+        /// <summary>
+        /// Parses a JSON Pointer. Throws <see cref="json_exception"/> if the pointer is malformed.
+        /// </summary>
+        /// <param name="pointer">The pointer in its string representation, for example <c>/a~1b/0</c>.</param>
+        _ASYNCRTIMP explicit json_pointer(const utility::string_t &pointer);
+
+        /// <summary>
+        /// Finds the value the pointer refers to.
+        /// </summary>
+        /// <param name="root">The document to evaluate the pointer against.</param>
+        /// <returns>The value, or <c>nullptr</c> if the document does not contain it.</returns>
+        _ASYNCRTIMP const json::value *find(const json::value &root) const;
+
+        /// <summary>
+        /// Finds the value the pointer refers to.
+        /// </summary>
+        /// <param name="root">The document to evaluate the pointer against.</param>
+        /// <returns>The value, or <c>nullptr</c> if the document does not contain it.</returns>
+        _ASYNCRTIMP json::value *find(json::value &root) const;
+
+        /// <summary>
+        /// Accesses the value the pointer refers to. Throws <see cref="json_exception"/> if the document does not contain it.
+        /// </summary>
+        /// <param name="root">The document to evaluate the pointer against.</param>
+        /// <returns>A reference to the value.</returns>
+        _ASYNCRTIMP const json::value &at(const json::value &root) const;
+
+        /// <summary>
+        /// Gets the unescaped reference tokens of the pointer.
+        /// </summary>
+        /// <returns>The reference tokens, empty for the pointer to the whole document.</returns>
+        const std::vector<utility::string_t> &tokens() const { return m_tokens; }
+
+        /// <summary>
+        /// Gets the string representation of the pointer.
+        /// </summary>
+        /// <returns>The pointer with reference tokens escaped.</returns>
+        _ASYNCRTIMP utility::string_t to_string() const;
+
+    private:
+        // Array index of each token, or -1 if the token cannot index an array.
+        std::vector<int64_t> m_indices;
+        std::vector<utility::string_t> m_tokens;
+    };
+
+    /// <summary>
+    /// A compiled JSONPath query supporting a subset of the syntax: the root <c>$</c>, member access with
+    /// <c>.name</c> or <c>['name']</c>, array indices <c>[0]</c> (negative indices count from the end),
+    /// slices <c>[start:end]</c>, wildcards <c>.*</c> and <c>[*]</c>, and recursive descent <c>..name</c>.
+    /// </summary>
+    /// <remarks>
+    /// Queries are evaluated in place, the results point into the evaluated document and remain valid
+    /// only as long as the document is neither modified nor destroyed.
+    /// </remarks>
+    class json_path
+    {
+    public:
+        /// <summary>
+        /// Compiles a JSONPath expression. Throws <see cref="json_exception"/> if the expression is malformed or unsupported.
+        /// </summary>
+        /// <param name="expression">The expression, for example <c>$.store.book[*].author</c>.</param>
+        _ASYNCRTIMP explicit json_path(const utility::string_t &expression);
+
+        /// <summary>
+        /// Evaluates the query.
+        /// </summary>
+        /// <param name="root">The document to evaluate the query against.</param>
+        /// <returns>The matching values in document order.</returns>
+        _ASYNCRTIMP std::vector<const json::value *> evaluate(const json::value &root) const;
+
+        /// <summary>
+        /// Evaluates the query and returns the first match.
+        /// </summary>
+        /// <param name="root">The document to evaluate the query against.</param>
+        /// <returns>The first matching value, or <c>nullptr</c> if nothing matches.</returns>
+        _ASYNCRTIMP const json::value *find(const json::value &root) const;
+
+    private:
+        enum step_kind { member_step, index_step, slice_step, wildcard_step };
+
+        struct step
+        {
+            step_kind m_kind;
+            bool m_recursive;
+            utility::string_t m_name;
+            int64_t m_index;
+            int64_t m_end;
+            bool m_has_index;
+            bool m_has_end;
+        };
+
+        void apply(const step &s, const json::value &node, std::vector<const json::value *> &out) const;
+
+        std::vector<step> m_steps;
+    };
+
+}} // namespace web::json
+
+#endif
@@ -0,0 +1,140 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* HTTP Library: Pull based JSON reader
+*
+* For the latest on this and related APIs, please see: https://github.com/Microsoft/cpprestsdk
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+#pragma once
+
+#ifndef _CASA_JSON_READER_H
+#define _CASA_JSON_READER_H
+
+#include <memory>
+#include "cpprest/json.h"
+
+namespace web
+{
+namespace json
+{
+    namespace details
+    {
+        struct _json_reader_impl;
+    }
+
+    /// <summary>
+    /// Reads JSON text one token at a time without building <see cref="json::value"/> objects.
+    /// </summary>
+    /// <remarks>
+    /// The reader uses the same tokenizer as <c>value::parse</c> and validates the structure of the
+    /// document as it goes; any error throws a <see cref="json_exception"/> carrying the location of the
+    /// offending token. Separators are consumed by the reader, so every token returned by <c>read</c> is
+    /// either the start or end of a container, an object member name or a scalar value.
+    /// <para>The reader switches its thread to the C locale for as long as it lives, so it must be used and
+    /// destroyed on the thread which created it.</para>
+    /// </remarks>
+    class json_reader
+    {
+    public:
+        /// <summary>
+        /// The kinds of tokens returned by the reader.
+        /// </summary>
+        enum token_kind
+        {
+            end_of_input,
+            begin_object,
+            end_object,
+            begin_array,
+            end_array,
+            property_name,
+            string_value,
+            integer_value,
+            number_value,
+            boolean_value,
+            null_value
+        };
+
+        /// <summary>
+        /// Creates a reader over JSON text.
+        /// </summary>
+        /// <param name="text">The text to read, it must outlive the reader.</param>
+        _ASYNCRTIMP explicit json_reader(const utility::string_t &text);
+
+        _ASYNCRTIMP ~json_reader();
+
+        /// <summary>
+        /// Advances to the next token.
+        /// </summary>
+        /// <returns>The kind of the token, <c>end_of_input</c> once the single top level value has been read.</returns>
+        _ASYNCRTIMP token_kind read();
+
+        /// <summary>
+        /// If the current token starts an object or an array, advances to the token which ends it.
+        /// Does nothing for any other token.
+        /// </summary>
+        _ASYNCRTIMP void skip();
+
+        /// <summary>
+        /// Throws a <see cref="json_exception"/> reporting an error at the current token.
+        /// </summary>
+        /// <param name="message">Description of the error.</param>
+        _ASYNCRTIMP void fail(const utility::string_t &message) const;
+
+        /// <summary>
+        /// Gets the kind of the current token.
+        /// </summary>
+        token_kind kind() const { return m_kind; }
+
+        /// <summary>
+        /// Gets the unescaped text of the current <c>property_name</c> or <c>string_value</c> token.
+        /// </summary>
+        const utility::string_t &text() const { return m_text; }
+
+        /// <summary>
+        /// Determines whether the current <c>integer_value</c> token is held as a signed integer.
+        /// Negative integers are held signed, all others unsigned.
+        /// </summary>
+        bool is_signed() const { return m_signed; }
+
+        /// <summary>
+        /// Gets the value of the current <c>integer_value</c> token if it is signed.
+        /// </summary>
+        int64_t as_int64() const { return m_int64; }
+
+        /// <summary>
+        /// Gets the value of the current <c>integer_value</c> token if it is unsigned.
+        /// </summary>
+        uint64_t as_uint64() const { return m_uint64; }
+
+        /// <summary>
+        /// Gets the value of the current <c>integer_value</c> or <c>number_value</c> token as a double.
+        /// </summary>
+        double as_double() const { return m_double; }
+
+        /// <summary>
+        /// Gets the value of the current <c>boolean_value</c> token.
+        /// </summary>
+        bool as_bool() const { return m_boolean; }
+
+    private:
+        json_reader(const json_reader &);
+        json_reader &operator=(const json_reader &);
+
+        std::unique_ptr<details::_json_reader_impl> m_impl;
+        token_kind m_kind;
+        utility::string_t m_text;
+        bool m_signed;
+        bool m_boolean;
+        int64_t m_int64;
+        uint64_t m_uint64;
+        double m_double;
+    };
+
+}} // namespace web::json
+
+#endif
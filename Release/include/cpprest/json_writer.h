@@ -0,0 +1,193 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* HTTP Library: Streaming JSON writer
+*
+* For the latest on this and related APIs, please see: https://github.com/Microsoft/cpprestsdk
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+#pragma once
+
+#ifndef _CASA_JSON_WRITER_H
+#define _CASA_JSON_WRITER_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "cpprest/json.h"
+#include "cpprest/astreambuf.h"
+
+namespace web
+{
+namespace json
+{
+    /// <summary>
+    /// Writes UTF-8 encoded JSON text to a stream buffer or a standard output stream token by token,
+    /// without first formatting the whole document into a single string.
+    /// </summary>
+    /// <remarks>
+    /// Output is accumulated in a chunk of at most about <c>chunk_size</c> bytes which is handed to the
+    /// target whenever it fills up, so the memory used is bounded regardless of the size of the document.
+    /// When writing to a stream buffer one chunk may be in flight while the next one is being filled.
+    /// Call <c>flush</c> once done to write out the remaining output. A writer is not thread safe.
+    /// </remarks>
+    class json_writer
+    {
+    public:
+        /// <summary>
+        /// The default number of bytes accumulated before they are written to the target.
+        /// </summary>
+        static const size_t default_chunk_size = 64 * 1024;
+
+        /// <summary>
+        /// Creates a writer that writes to an asynchronous stream buffer.
+        /// </summary>
+        /// <param name="buffer">The stream buffer to write to, it must be open for writing.</param>
+        /// <param name="chunk_size">The number of bytes accumulated before they are written to the stream buffer.</param>
+        _ASYNCRTIMP json_writer(concurrency::streams::streambuf<uint8_t> buffer, size_t chunk_size = default_chunk_size);
+
+        /// <summary>
+        /// Creates a writer that writes to a standard output stream.
+        /// </summary>
+        /// <param name="stream">The stream to write to, it must outlive the writer.</param>
+        /// <param name="chunk_size">The number of bytes accumulated before they are written to the stream.</param>
+        _ASYNCRTIMP json_writer(std::ostream &stream, size_t chunk_size = default_chunk_size);
+
+        /// <summary>
+        /// Destructor. Output which has not been flushed is discarded.
+        /// </summary>
+        _ASYNCRTIMP ~json_writer();
+
+        /// <summary>
+        /// Starts a JSON object, subsequent output consists of <c>key</c> and value pairs until <c>end_object</c>.
+        /// </summary>
+        _ASYNCRTIMP void begin_object();
+
+        /// <summary>
+        /// Ends the JSON object started by the matching <c>begin_object</c>.
+        /// </summary>
+        _ASYNCRTIMP void end_object();
+
+        /// <summary>
+        /// Starts a JSON array, subsequent values are its elements until <c>end_array</c>.
+        /// </summary>
+        _ASYNCRTIMP void begin_array();
+
+        /// <summary>
+        /// Ends the JSON array started by the matching <c>begin_array</c>.
+        /// </summary>
+        _ASYNCRTIMP void end_array();
+
+        /// <summary>
+        /// Writes the name of the next field of the current object.
+        /// </summary>
+        /// <param name="name">The field name.</param>
+        _ASYNCRTIMP void key(const utility::string_t &name);
+
+        /// <summary>
+        /// Writes a complete JSON value.
+        /// </summary>
+        /// <param name="val">The value to write.</param>
+        /// <remarks>Large objects and arrays are written out in chunks as they are traversed.</remarks>
+        _ASYNCRTIMP void write(const json::value &val);
+
+        /// <summary>
+        /// Writes a null value.
+        /// </summary>
+        _ASYNCRTIMP void null();
+
+        /// <summary>
+        /// Writes a Boolean value.
+        /// </summary>
+        /// <param name="val">The value to write.</param>
+        _ASYNCRTIMP void boolean(bool val);
+
+        /// <summary>
+        /// Writes a number value.
+        /// </summary>
+        /// <param name="val">The value to write.</param>
+        _ASYNCRTIMP void number(int32_t val);
+
+        /// <summary>
+        /// Writes a number value.
+        /// </summary>
+        /// <param name="val">The value to write.</param>
+        _ASYNCRTIMP void number(uint32_t val);
+
+        /// <summary>
+        /// Writes a number value.
+        /// </summary>
+        /// <param name="val">The value to write.</param>
+        _ASYNCRTIMP void number(int64_t val);
+
+        /// <summary>
+        /// Writes a number value.
+        /// </summary>
+        /// <param name="val">The value to write.</param>
+        _ASYNCRTIMP void number(uint64_t val);
+
+        /// <summary>
+        /// Writes a number value.
+        /// </summary>
+        /// <param name="val">The value to write.</param>
+        _ASYNCRTIMP void number(double val);
+
+        /// <summary>
+        /// Writes a string value, escaping characters as required.
+        /// </summary>
+        /// <param name="val">The value to write.</param>
+        _ASYNCRTIMP void string(const utility::string_t &val);
+
+        /// <summary>
+        /// Writes all buffered output to the target and flushes it.
+        /// </summary>
+        /// <returns>A task that completes once the output has been written.</returns>
+        _ASYNCRTIMP pplx::task<void> flush();
+
+    private:
+        json_writer(const json_writer &);
+        json_writer & operator=(const json_writer &);
+
+        // Called before a value is written; emits a separator and validates the position.
+        void before_value();
+
+        // Writes the current chunk to the target if it has reached the chunk size.
+        void flush_if_full()
+        {
+            if (m_chunk.size() >= m_chunk_size)
+            {
+                write_chunk();
+            }
+        }
+
+        void write_chunk();
+        void write_value(const json::value &val);
+
+        enum scope_kind { object_scope, array_scope };
+        struct scope
+        {
+            scope_kind m_kind;
+            bool m_empty;
+        };
+
+        concurrency::streams::streambuf<uint8_t> m_buffer;
+        std::ostream *m_stream;
+        size_t m_chunk_size;
+        std::string m_chunk;
+
+        // Holds the chunk being written to the stream buffer until m_pending completes.
+        std::string m_inflight;
+        pplx::task<void> m_pending;
+
+        std::vector<scope> m_scopes;
+        bool m_expect_value;
+        bool m_complete;
+    };
+
+}} // namespace web::json
+
+#endif
@@ -53,6 +53,10 @@
 #include "pplx/pplxcancellation_token.h"
 #include <functional>
 
+#if defined(CPPREST_PPLX_METRICS)
+#include "pplx/pplxmetrics.h"
+#endif
+
 // conditional expression is constant
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -100,7 +104,65 @@ namespace details
         _T *_Ptr;
     };
 
-    struct _TaskProcHandle
+    /// <summary>
+    /// Allocates memory for an object created for a task from a cache kept by the current thread.
+    /// </summary>
+    _PPLXIMP void * _pplx_cdecl _AllocatePooled(size_t _Size);
+
+    /// <summary>
+    /// Frees memory from <c>_AllocatePooled</c>, returning it to the cache of the current thread.
+    /// </summary>
+    _PPLXIMP void _pplx_cdecl _FreePooled(void * _Ptr, size_t _Size);
+
+    // Objects created for every task, such as task handles, derive from this to use the pooled allocation.
+    struct _PooledObject
+    {
+        static void * operator new(size_t _Size)
+        {
+            return _AllocatePooled(_Size);
+        }
+
+        static void operator delete(void * _Ptr, size_t _Size)
+        {
+            _FreePooled(_Ptr, _Size);
+        }
+    };
+
+    // Allocator for the objects shared between tasks, such as the task implementations.
+    template<typename _Ty>
+    struct _PooledAllocator
+    {
+        typedef _Ty value_type;
+
+        _PooledAllocator() {}
+
+        template<typename _Other>
+        _PooledAllocator(const _PooledAllocator<_Other>&) {}
+
+        _Ty * allocate(size_t _Count)
+        {
+            return static_cast<_Ty *>(_AllocatePooled(_Count * sizeof(_Ty)));
+        }
+
+        void deallocate(_Ty * _Ptr, size_t _Count)
+        {
+            _FreePooled(_Ptr, _Count * sizeof(_Ty));
+        }
+
+        template<typename _Other>
+        struct rebind
+        {
+            typedef _PooledAllocator<_Other> other;
+        };
+    };
+
+    template<typename _Ty, typename _Other>
+    inline bool operator==(const _PooledAllocator<_Ty>&, const _PooledAllocator<_Other>&) { return true; }
+
+    template<typename _Ty, typename _Other>
+    inline bool operator!=(const _PooledAllocator<_Ty>&, const _PooledAllocator<_Other>&) { return false; }
+
+    struct _TaskProcHandle : _PooledObject
     {
         _TaskProcHandle()
         {
@@ -125,8 +187,39 @@ namespace details
         _DefaultAutoInline = 16,
         // Always do inline scheduling
         _ForceInline = -1,
+        // Do inline scheduling unless the stack of inlined functions is too deep, used by synchronous continuations
+        _SynchronousInline = -2,
+    };
+
+    // The number of functions which may run inline on a thread before synchronous continuations are scheduled.
+    static const long _MaxInlineDepth = 16;
+
+    /// <summary>
+    /// Adds <paramref name="_Delta"/> to the number of functions running inline on the current thread.
+    /// </summary>
+    /// <returns>The new number of functions running inline.</returns>
+    _PPLXIMP long _pplx_cdecl _AdjustInlineDepth(long _Delta);
+
+    // Counts a function running inline on the current thread for as long as it is in scope.
+    struct _InlineDepthScope
+    {
+        _InlineDepthScope()
+        {
+            _AdjustInlineDepth(1);
+#if defined(CPPREST_PPLX_METRICS)
+            _RecordMetric(_Metric_functions_inlined);
+#endif
+        }
+        ~_InlineDepthScope() { _AdjustInlineDepth(-1); }
     };
 
+    // Synchronous continuations run on the current thread while fewer than _MaxInlineDepth functions are already
+    // running inline on it, which bounds the depth of the stack. Automatic inlining is left to the scheduler.
+    inline bool _ShouldRunInline(_TaskInliningMode _InliningMode)
+    {
+        return _InliningMode == _ForceInline || (_InliningMode == _SynchronousInline && _AdjustInlineDepth(0) < _MaxInlineDepth);
+    }
+
     // This is an abstraction that is built on top of the scheduler to provide these additional functionalities
     // - Ability to wait on a work item
     // - Ability to cancel a work item
@@ -144,8 +237,9 @@ namespace details
 
         void _ScheduleTask(_TaskProcHandle_t* _PTaskHandle, _TaskInliningMode _InliningMode)
         {
-            if (_InliningMode == _ForceInline)
+            if (_ShouldRunInline(_InliningMode))
             {
+                _InlineDepthScope _Scope;
                 _TaskProcHandle_t::_RunChoreBridge(_PTaskHandle);
             }
             else
@@ -183,8 +277,9 @@ namespace details
         // Fire and forget
         static void _RunTask(TaskProc_t _Proc, void * _Parameter, _TaskInliningMode _InliningMode)
         {
-            if (_InliningMode == _ForceInline)
+            if (_ShouldRunInline(_InliningMode))
             {
+                _InlineDepthScope _Scope;
                 _Proc(_Parameter);
             }
             else
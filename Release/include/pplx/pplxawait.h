@@ -0,0 +1,149 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* Coroutine support for PPLX tasks: co_await on a task and tasks as coroutine return types
+*
+* For the latest on this and related APIs, please see: https://github.com/Microsoft/cpprestsdk
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+
+#pragma once
+
+#ifndef _PPLXAWAIT_H
+#define _PPLXAWAIT_H
+
+#include "pplx/pplxtasks.h"
+
+#if (defined(_MSC_VER) && (_MSC_VER >= 1800)) && !CPPREST_FORCE_PPLX
+
+// pplx::task is concurrency::task, which the Visual C++ runtime makes awaitable when compiling with /await.
+#if defined(_RESUMABLE_FUNCTIONS_SUPPORTED)
+#include <pplawait.h>
+#endif
+
+#else
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#define _PPLX_COROUTINE_NS std
+#endif
+#elif defined(__cpp_coroutines) && defined(__has_include)
+#if __has_include(<experimental/coroutine>)
+#include <experimental/coroutine>
+#define _PPLX_COROUTINE_NS std::experimental
+#endif
+#endif
+
+#if defined(_PPLX_COROUTINE_NS)
+
+#define CPPREST_PPLX_COROUTINES
+
+namespace pplx
+{
+namespace details
+{
+    /// <summary>
+    ///     Suspends a coroutine until a task completes. A task which is already done is not waited for, and otherwise the
+    ///     coroutine resumes on the thread completing the task, without a round trip through the scheduler.
+    /// </summary>
+    template<typename _Ty>
+    struct _Task_awaiter
+    {
+        task<_Ty> _M_task;
+
+        bool await_ready() const
+        {
+            return _M_task.is_done();
+        }
+
+        void await_suspend(_PPLX_COROUTINE_NS::coroutine_handle<> _Handle)
+        {
+            _M_task.then([_Handle](task<_Ty>) { _Handle.resume(); }, task_continuation_context::use_synchronous_execution());
+        }
+
+        _Ty await_resume()
+        {
+            return _M_task.get();
+        }
+    };
+
+    // The state of a coroutine returning a task, which completes the task when the coroutine returns or throws.
+    template<typename _Ty>
+    struct _Task_promise_base
+    {
+        task_completion_event<_Ty> _M_tce;
+
+        task<_Ty> get_return_object()
+        {
+            return create_task(_M_tce);
+        }
+
+        _PPLX_COROUTINE_NS::suspend_never initial_suspend()
+        {
+            return _PPLX_COROUTINE_NS::suspend_never();
+        }
+
+        _PPLX_COROUTINE_NS::suspend_never final_suspend() noexcept
+        {
+            return _PPLX_COROUTINE_NS::suspend_never();
+        }
+
+        void unhandled_exception()
+        {
+            _M_tce.set_exception(std::current_exception());
+        }
+    };
+
+    template<typename _Ty>
+    struct _Task_promise : _Task_promise_base<_Ty>
+    {
+        template<typename _Value>
+        void return_value(_Value&& _Val)
+        {
+            this->_M_tce.set(std::forward<_Value>(_Val));
+        }
+    };
+
+    template<>
+    struct _Task_promise<void> : _Task_promise_base<void>
+    {
+        void return_void()
+        {
+            this->_M_tce.set();
+        }
+    };
+} // namespace details
+
+/// <summary>
+///     Allows <c>co_await</c> on a task. The expression yields the result of the task, or throws its exception.
+/// </summary>
+template<typename _Ty>
+details::_Task_awaiter<_Ty> operator co_await(const task<_Ty>& _Task)
+{
+    return details::_Task_awaiter<_Ty>{ _Task };
+}
+
+} // namespace pplx
+
+namespace _PPLX_COROUTINE_NS
+{
+    /// <summary>
+    ///     Allows coroutines to return a task, which completes with the value of <c>co_return</c>.
+    /// </summary>
+    template<typename _Ty, typename... _Args>
+    struct coroutine_traits<pplx::task<_Ty>, _Args...>
+    {
+        typedef pplx::details::_Task_promise<_Ty> promise_type;
+    };
+}
+
+#endif // _PPLX_COROUTINE_NS
+
+#endif
+
+#endif // _PPLXAWAIT_H
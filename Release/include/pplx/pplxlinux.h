@@ -35,6 +35,10 @@
 
 #include "pplx/pplxinterface.h"
 
+namespace crossplat
+{
+    struct threadpool_options;
+}
 
 namespace pplx
 {
@@ -242,6 +246,45 @@ namespace platform
         _PPLXIMP virtual void schedule( TaskProc_t proc, _In_ void* param);
     };
 
+#if !defined(__APPLE__)
+    class _work_stealing_impl;
+
+    /// <summary>
+    /// A scheduler with a fixed set of worker threads, each owning a deque of tasks. Tasks scheduled from a worker,
+    /// such as continuations of tasks running on it, are pushed to and popped from the back of its own deque without
+    /// taking a lock; idle workers steal from the front of the deques of other workers. Tasks scheduled from any
+    /// other thread go through a shared queue.
+    /// </summary>
+    /// <remarks>
+    /// Install it with <c>pplx::set_ambient_scheduler</c> or pass it in <c>task_options</c>. Building with
+    /// CPPREST_PPLX_WORK_STEALING makes it the default scheduler. Tasks which are still queued when the scheduler is
+    /// destroyed are run before the destructor returns, and tasks scheduled after that run on the calling thread.
+    /// </remarks>
+    class work_stealing_scheduler : public pplx::scheduler_interface
+    {
+    public:
+        /// <summary>
+        /// Creates a scheduler with the given number of workers, 0 for one per hardware thread.
+        /// </summary>
+        _PPLXIMP explicit work_stealing_scheduler(size_t num_threads = 0);
+
+        /// <summary>
+        /// Creates a scheduler with <c>min_threads</c> workers, named and pinned as requested by the options.
+        /// The number of workers is fixed, so <c>max_threads</c> and <c>idle_timeout</c> are ignored.
+        /// </summary>
+        _PPLXIMP explicit work_stealing_scheduler(const crossplat::threadpool_options &options);
+
+        _PPLXIMP virtual ~work_stealing_scheduler();
+        _PPLXIMP virtual void schedule( TaskProc_t proc, _In_ void* param);
+
+    private:
+        work_stealing_scheduler(const work_stealing_scheduler&);
+        work_stealing_scheduler& operator=(const work_stealing_scheduler&);
+
+        std::shared_ptr<_work_stealing_impl> m_impl;
+    };
+#endif
+
 } // namespace details
 
 /// <summary>
@@ -290,6 +333,8 @@ namespace extensibility
 /// </summary>
 #if defined(__APPLE__)
     typedef details::apple_scheduler default_scheduler_t;
+#elif defined(CPPREST_PPLX_WORK_STEALING)
+    typedef details::work_stealing_scheduler default_scheduler_t;
 #else
     typedef details::linux_scheduler default_scheduler_t;
 #endif
@@ -0,0 +1,219 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* Parallel Patterns Library : scheduler metrics
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+
+#pragma once
+
+#ifndef _PPLX_H
+#error This header must not be included directly
+#endif
+
+#ifndef _PPLXMETRICS_H
+#define _PPLXMETRICS_H
+
+#if defined(_WIN32)
+#error CPPREST_PPLX_METRICS is only supported on Linux and OS X
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+namespace pplx
+{
+
+/// <summary>
+///     A histogram of durations. Each power of two of nanoseconds is split into 8 buckets, so a duration is known
+///     to within 12.5% whatever its magnitude.
+/// </summary>
+class latency_histogram
+{
+public:
+    static const size_t bucket_count = 496;
+
+    latency_histogram() : m_buckets(), m_count(0), m_total(0)
+    {
+    }
+
+    /// <summary>
+    ///     The bucket counting a duration of <paramref name="nanoseconds"/>.
+    /// </summary>
+    static size_t bucket_index(uint64_t nanoseconds)
+    {
+        if (nanoseconds < 8)
+        {
+            return static_cast<size_t>(nanoseconds);
+        }
+        const int exponent = 63 - __builtin_clzll(nanoseconds);
+        return static_cast<size_t>((exponent - 2) * 8) + static_cast<size_t>((nanoseconds >> (exponent - 3)) & 7);
+    }
+
+    /// <summary>
+    ///     The longest duration counted by a bucket.
+    /// </summary>
+    static uint64_t bucket_upper_bound(size_t index)
+    {
+        if (index < 8)
+        {
+            return index;
+        }
+        const size_t shift = index / 8 - 1;
+        return ((8 + index % 8) << shift) + ((uint64_t(1) << shift) - 1);
+    }
+
+    void record(uint64_t nanoseconds)
+    {
+        ++m_buckets[bucket_index(nanoseconds)];
+        ++m_count;
+        m_total += nanoseconds;
+    }
+
+    void add(size_t index, uint64_t count)
+    {
+        m_buckets[index] += count;
+        m_count += count;
+    }
+
+    void add_total(uint64_t nanoseconds)
+    {
+        m_total += nanoseconds;
+    }
+
+    uint64_t bucket(size_t index) const { return m_buckets[index]; }
+
+    /// <summary>
+    ///     The number of durations recorded.
+    /// </summary>
+    uint64_t count() const { return m_count; }
+
+    /// <summary>
+    ///     The sum of the durations recorded.
+    /// </summary>
+    std::chrono::nanoseconds total() const { return std::chrono::nanoseconds(static_cast<int64_t>(m_total)); }
+
+    /// <summary>
+    ///     An upper bound of the duration below which a fraction <paramref name="quantile"/> of the durations fall,
+    ///     for example 0.99 for the 99th percentile. Zero if nothing was recorded.
+    /// </summary>
+    std::chrono::nanoseconds percentile(double quantile) const
+    {
+        if (m_count == 0)
+        {
+            return std::chrono::nanoseconds(0);
+        }
+
+        const uint64_t rank = (std::min)(static_cast<uint64_t>(quantile * static_cast<double>(m_count)), m_count - 1);
+        uint64_t seen = 0;
+        size_t index = 0;
+        for (; index < bucket_count - 1; ++index)
+        {
+            seen += m_buckets[index];
+            if (seen > rank)
+            {
+                break;
+            }
+        }
+        const uint64_t bound = (std::min)(bucket_upper_bound(index), static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()));
+        return std::chrono::nanoseconds(static_cast<int64_t>(bound));
+    }
+
+private:
+    uint64_t m_buckets[bucket_count];
+    uint64_t m_count;
+    uint64_t m_total;
+};
+
+/// <summary>
+///     Counters and histograms collected by the pplx tasks and schedulers when built with CPPREST_PPLX_METRICS. The
+///     values are totals since the process started, exporters report the difference between two snapshots.
+/// </summary>
+/// <remarks>
+///     Each thread updates its own counters without synchronization. A scheduled function costs two reads of the
+///     steady clock and the allocation of a small pooled record, a task two more clock reads.
+/// </remarks>
+struct scheduler_metrics
+{
+    scheduler_metrics() : tasks_created(0), continuations_scheduled(0), functions_inlined(0), functions_queued(0), functions_dequeued(0)
+    {
+    }
+
+    /// <summary>
+    ///     Tasks started with <c>create_task</c> or the task constructor.
+    /// </summary>
+    uint64_t tasks_created;
+
+    /// <summary>
+    ///     Continuations scheduled once their antecedent completed.
+    /// </summary>
+    uint64_t continuations_scheduled;
+
+    /// <summary>
+    ///     Task functions run inline on the thread completing their antecedent instead of going through the scheduler.
+    /// </summary>
+    uint64_t functions_inlined;
+
+    /// <summary>
+    ///     Functions passed to the scheduler.
+    /// </summary>
+    uint64_t functions_queued;
+
+    /// <summary>
+    ///     Functions the scheduler started running.
+    /// </summary>
+    uint64_t functions_dequeued;
+
+    /// <summary>
+    ///     The number of functions waiting in the scheduler.
+    /// </summary>
+    uint64_t queue_depth() const { return functions_queued - functions_dequeued; }
+
+    /// <summary>
+    ///     The time functions wait in the scheduler before they start running.
+    /// </summary>
+    latency_histogram queue_latency;
+
+    /// <summary>
+    ///     The time task bodies take to run, including the scheduling of their continuations.
+    /// </summary>
+    latency_histogram execution_time;
+};
+
+/// <summary>
+///     Adds up the metrics of all the threads, including threads which exited.
+/// </summary>
+_PPLXIMP scheduler_metrics _pplx_cdecl get_scheduler_metrics();
+
+namespace details
+{
+    enum _Metric_counter
+    {
+        _Metric_tasks_created,
+        _Metric_continuations_scheduled,
+        _Metric_functions_inlined,
+        _Metric_functions_queued,
+        _Metric_functions_dequeued,
+        _Metric_counter_count
+    };
+
+    enum _Metric_histogram
+    {
+        _Metric_queue_latency,
+        _Metric_execution_time,
+        _Metric_histogram_count
+    };
+
+    _PPLXIMP void _pplx_cdecl _RecordMetric(_Metric_counter _Counter);
+    _PPLXIMP void _pplx_cdecl _RecordMetric(_Metric_histogram _Histogram, std::chrono::steady_clock::duration _Duration);
+}
+
+} // namespace pplx
+
+#endif // _PPLXMETRICS_H
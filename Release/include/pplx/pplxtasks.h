@@ -53,6 +53,7 @@ void cpprest_init(JavaVM*);
 #endif /*IFSTRIP=IGN*/
 #endif /* defined(_MSC_VER) */
 
+#include <atomic>
 #include <functional>
 #include <vector>
 #include <utility>
@@ -513,7 +514,7 @@ namespace details
     /// <summary>
     ///     Helper object used for LWT invocation.
     /// </summary>
-    struct _TaskProcThunk
+    struct _TaskProcThunk : _PooledObject
     {
         _TaskProcThunk(const std::function<void ()> & _Callback) :
             _M_func(_Callback)
@@ -1191,11 +1192,41 @@ public:
     }
 #endif  /* defined (__cplusplus_winrt) */
 
+    /// <summary>
+    ///     Returns a task continuation context object that represents the synchronous execution context.
+    /// </summary>
+    /// <returns>
+    ///     The synchronous execution context.
+    /// </returns>
+    /// <remarks>
+    ///     A continuation using this context runs on the thread which completes the antecedent task, or on the thread calling
+    ///     <c>then</c> if the antecedent has already completed, as with <c>task_from_result</c>. This saves a round trip through
+    ///     the scheduler, so it suits short continuations which do not block. If too many continuations are already running
+    ///     inline on the thread, the continuation is scheduled instead, so that long chains cannot overflow the stack.
+    /// </remarks>
+    /**/
+    static task_continuation_context use_synchronous_execution()
+    {
+        task_continuation_context _SyncContext;
+        _SyncContext._M_RunInline = true;
+        return _SyncContext;
+    }
+
+    /// <summary>
+    ///     Determines whether continuations using this context run inline.
+    /// </summary>
+    bool _RunInline() const
+    {
+        return _M_RunInline;
+    }
+
 private:
 
-    task_continuation_context(bool _DeferCapture = false) : details::_ContextCallback(_DeferCapture)
+    task_continuation_context(bool _DeferCapture = false) : details::_ContextCallback(_DeferCapture), _M_RunInline(false)
     {
     }
+
+    bool _M_RunInline;
 };
 
 class task_options;
@@ -1414,7 +1445,7 @@ namespace details
     struct _Task_ptr
     {
         typedef std::shared_ptr<_Task_impl<_ReturnType>> _Type;
-        static _Type _Make(_CancellationTokenState * _Ct, scheduler_ptr _Scheduler_arg) { return std::make_shared<_Task_impl<_ReturnType>>(_Ct, _Scheduler_arg); }
+        static _Type _Make(_CancellationTokenState * _Ct, scheduler_ptr _Scheduler_arg) { return std::allocate_shared<_Task_impl<_ReturnType>>(_PooledAllocator<_Task_impl<_ReturnType>>(), _Ct, _Scheduler_arg); }
     };
 
     typedef _TaskCollection_t::_TaskProcHandle_t _UnrealizedChore_t;
@@ -1571,6 +1602,40 @@ namespace details
         _TaskWorkItemRAIILogger &operator =(const _TaskWorkItemRAIILogger &); // cannot be assigned
     };
 
+#elif defined(CPPREST_PPLX_METRICS)
+    inline void _LogCancelTask(_Task_impl_base *) {}
+
+    // Feeds the scheduler metrics, see pplx/pplxmetrics.h.
+    struct _TaskEventLogger
+    {
+        std::chrono::steady_clock::time_point _M_started;
+
+        void _LogScheduleTask(bool _isContinuation)
+        {
+            _RecordMetric(_isContinuation ? _Metric_continuations_scheduled : _Metric_tasks_created);
+        }
+
+        void _LogCancelTask() {}
+        void _LogWorkItemStarted() {}
+        void _LogWorkItemCompleted() {}
+
+        void _LogTaskExecutionStarted()
+        {
+            _M_started = std::chrono::steady_clock::now();
+        }
+
+        void _LogTaskExecutionCompleted()
+        {
+            _RecordMetric(_Metric_execution_time, std::chrono::steady_clock::now() - _M_started);
+        }
+
+        void _LogTaskCompleted() {}
+        _TaskEventLogger(_Task_impl_base *) {}
+    };
+    struct _TaskWorkItemRAIILogger
+    {
+        _TaskWorkItemRAIILogger(_TaskEventLogger &) {}
+    };
 #else
     inline void _LogCancelTask(_Task_impl_base *) {}
     struct _TaskEventLogger
@@ -2113,35 +2178,37 @@ namespace details
         {
             enum { _Nothing, _Schedule, _Cancel, _CancelWithException } _Do = _Nothing;
 
-            // If the task has canceled, cancel the continuation. If the task has completed, execute the continuation right away.
-            // Otherwise, add it to the list of pending continuations
+            // Add the continuation to the list of pending continuations, unless the list has been closed because the task reached
+            // its final state. The state is set before the list is closed, so it can be read without the lock from then on.
+            auto _Head = _M_Continuations.load(std::memory_order_acquire);
+            while (_Head != _ClosedContinuations())
             {
-                ::pplx::extensibility::scoped_critical_section_t _LockHolder(_M_ContinuationsCritSec);
-                if (_IsCompleted() || (_IsCanceled() && _PTaskHandle->_M_isTaskBasedContinuation))
+                _PTaskHandle->_M_next = _Head;
+                if (_M_Continuations.compare_exchange_weak(_Head, _PTaskHandle, std::memory_order_release, std::memory_order_acquire))
                 {
-                    _Do = _Schedule;
+                    return;
                 }
-                else if (_IsCanceled())
+            }
+
+            // If the task has canceled, cancel the continuation. If the task has completed, execute the continuation right away.
+            if (_IsCompleted() || (_IsCanceled() && _PTaskHandle->_M_isTaskBasedContinuation))
+            {
+                _Do = _Schedule;
+            }
+            else
+            {
+                _ASSERTE(_IsCanceled());
+                if (_HasUserException())
                 {
-                    if (_HasUserException())
-                    {
-                        _Do = _CancelWithException;
-                    }
-                    else
-                    {
-                        _Do = _Cancel;
-                    }
+                    _Do = _CancelWithException;
                 }
                 else
                 {
-                    // chain itself on the continuation chain.
-                    _PTaskHandle->_M_next = _M_Continuations;
-                    _M_Continuations = _PTaskHandle;
+                    _Do = _Cancel;
                 }
             }
 
-            // Cancellation and execution of continuations should be performed after releasing the lock. Continuations off of
-            // async tasks may execute inline.
+            // Continuations off of async tasks may execute inline.
             switch (_Do)
             {
                 case _Schedule:
@@ -2169,18 +2236,27 @@ namespace details
                 }
                 case _Nothing:
                 default:
-                    // In this case, we have inserted continuation to continuation chain,
-                    // nothing more need to be done, just leave.
                     break;
             }
         }
 
-        void _RunTaskContinuations()
+        typedef _ContinuationTaskHandleBase * _ContinuationList;
+
+        // Closes the list of continuations and returns the ones added so far. Continuations added later run by themselves.
+        _ContinuationList _CloseContinuations()
+        {
+            return _M_Continuations.exchange(_ClosedContinuations(), std::memory_order_acq_rel);
+        }
+
+        // Marks the list of continuations as closed. Never dereferenced.
+        _ContinuationList _ClosedContinuations()
         {
-            // The link list can no longer be modified at this point,
-            // since all following up continuations will be scheduled by themselves.
-            _ContinuationList _Cur = _M_Continuations, _Next;
-            _M_Continuations = nullptr;
+            return reinterpret_cast<_ContinuationList>(&_M_Continuations);
+        }
+
+        void _RunTaskContinuations(_ContinuationList _Cur)
+        {
+            _ContinuationList _Next;
             while (_Cur)
             {
                 // Current node might be deleted after running,
@@ -2343,8 +2419,8 @@ namespace details
         // The registration on the token.
         _CancellationTokenRegistration * _M_pRegistration;
 
-        typedef _ContinuationTaskHandleBase * _ContinuationList;
-        _ContinuationList _M_Continuations;
+        // Pending continuations, pushed without taking a lock.
+        std::atomic<_ContinuationList> _M_Continuations;
 
         // The async task collection wrapper
         ::pplx::details::_TaskCollection_t _M_TaskCollection;
@@ -2492,10 +2568,11 @@ namespace details
             {
                 _M_TaskCollection._Complete();
 
-                if (_M_Continuations)
+                auto _Continuations = _CloseContinuations();
+                if (_Continuations)
                 {
                     // Scheduling cancellation with automatic inlining.
-                    _ScheduleFuncWithAutoInline([=](){ _RunTaskContinuations(); }, details::_DefaultAutoInline);
+                    _ScheduleFuncWithAutoInline([=](){ _RunTaskContinuations(_Continuations); }, details::_DefaultAutoInline);
                 }
             }
             return true;
@@ -2524,7 +2601,7 @@ namespace details
                 _M_TaskState = _Completed;
             }
             _M_TaskCollection._Complete();
-            _RunTaskContinuations();
+            _RunTaskContinuations(_CloseContinuations());
         }
 
         //
@@ -2613,8 +2690,9 @@ namespace details
         ::pplx::extensibility::critical_section_t             _M_taskListCritSec;
         _ResultHolder<_ResultType>         _M_value;
         std::shared_ptr<_ExceptionHolder>   _M_exceptionHolder;
-        bool                                _M_fHasValue;
-        bool                                _M_fIsCanceled;
+        // Read without the lock to ignore events which are already triggered.
+        std::atomic<bool>                   _M_fHasValue;
+        std::atomic<bool>                   _M_fIsCanceled;
     };
 
     // Utility method for dealing with void functions
@@ -2667,7 +2745,7 @@ public:
     /// </summary>
     /**/
     task_completion_event() 
-        : _M_Impl(std::make_shared<details::_Task_completion_event_impl<_ResultType>>()) 
+        : _M_Impl(std::allocate_shared<details::_Task_completion_event_impl<_ResultType>>(details::_PooledAllocator<details::_Task_completion_event_impl<_ResultType>>())) 
     {
     }
 
@@ -4171,6 +4249,11 @@ private:
             }
         }
 
+        if (_ContinuationContext._RunInline())
+        {
+            _InliningMode = details::_SynchronousInline;
+        }
+
         task<_TaskType> _ContinuationTask;
         _ContinuationTask._CreateImpl(_PTokenState, _Scheduler);
 
@@ -6261,6 +6344,47 @@ details::_AsyncTaskGeneratorThunk<_Function> ^create_async(const _Function& _Fun
 
 namespace details
 {
+    // Reports the completion of a task to a join such as when_all or when_any. Unlike a continuation added with then(), it
+    // creates no task of its own and keeps the functor without wrapping it in a std::function. All the handles of a join
+    // are scheduled through one carrier task, which never runs itself.
+    template<typename _TaskType, typename _Function>
+    struct _JoinContinuationHandle : _ContinuationTaskHandleBase
+    {
+        _JoinContinuationHandle(const task<_TaskType>& _Ancestor, const _Task_ptr_base& _Carrier, const _Function& _Func)
+            : _M_ancestor(_Ancestor), _M_carrier(_Carrier), _M_func(_Func)
+        {
+            // Runs inline whether the task completed, faulted or was canceled.
+            _M_isTaskBasedContinuation = true;
+            _M_inliningMode = _ForceInline;
+        }
+
+        virtual _Task_ptr_base _GetTaskImplBase() const
+        {
+            return _M_carrier;
+        }
+
+        virtual void invoke() const
+        {
+            task<_TaskType> _Ancestor = _M_ancestor;
+            _M_func(_Ancestor);
+        }
+
+        task<_TaskType> _M_ancestor;
+        _Task_ptr_base _M_carrier;
+        _Function _M_func;
+    };
+
+    inline _Task_ptr_base _MakeJoinCarrier()
+    {
+        return _Task_ptr<_Unit_type>::_Make(_CancellationTokenState::_None(), scheduler_ptr(get_ambient_scheduler()));
+    }
+
+    template<typename _TaskType, typename _Function>
+    void _AddJoinContinuation(const task<_TaskType>& _Ancestor, const _Task_ptr_base& _Carrier, const _Function& _Func)
+    {
+        _Ancestor._GetImpl()->_ScheduleContinuation(new _JoinContinuationHandle<_TaskType, _Function>(_Ancestor, _Carrier, _Func));
+    }
+
     // Helper struct for when_all operators to know when tasks have completed
     template<typename _Type>
     struct _RunAllParam
@@ -6387,7 +6511,8 @@ namespace details
             task<_Unit_type> _All_tasks_completed(_PParam->_M_completed, _Options);
             // The return task must be created before step 3 to enforce inline execution.
             auto _ReturnTask = _All_tasks_completed._Then([=](_Unit_type) -> std::vector<_ElementType> {
-                return _PParam->_M_vector.Get();
+                // This runs inline before the last continuation deletes _PParam, and nothing reads the results after it.
+                return std::move(_PParam->_M_vector._Result);
             }, nullptr);
 
             // Step2: Combine and check tokens, and count elements in range.
@@ -6415,6 +6540,7 @@ namespace details
             }
             else
             {
+                auto _Carrier = _MakeJoinCarrier();
                 size_t _Index = 0;
                 for (auto _PTask = _Begin; _PTask != _End; ++_PTask)
                 {
@@ -6423,7 +6549,7 @@ namespace details
                         _ReturnTask._SetAsync();
                     }
 
-                    _PTask->_Then([_PParam, _Index](task<_ElementType> _ResultTask) {
+                    _AddJoinContinuation(*_PTask, _Carrier, [_PParam, _Index](task<_ElementType>& _ResultTask) {
 
                         auto _PParamCopy = _PParam;
                         auto _IndexCopy = _Index;
@@ -6432,7 +6558,7 @@ namespace details
                         };
 
                         _WhenAllContinuationWrapper(_PParam, _Func, _ResultTask);
-                    }, _CancellationTokenState::_None()); 
+                    }); 
 
                     _Index++;
                 }
@@ -6493,6 +6619,7 @@ namespace details
             }
             else
             {
+                auto _Carrier = _MakeJoinCarrier();
                 size_t _Index = 0;
                 for (auto _PTask = _Begin; _PTask != _End; ++_PTask)
                 {
@@ -6501,7 +6628,7 @@ namespace details
                         _ReturnTask._SetAsync();
                     }
 
-                    _PTask->_Then([_PParam, _Index](task<std::vector<_ElementType>> _ResultTask) {
+                    _AddJoinContinuation(*_PTask, _Carrier, [_PParam, _Index](task<std::vector<_ElementType>>& _ResultTask) {
 
                         auto _PParamCopy = _PParam;
                         auto _IndexCopy = _Index;
@@ -6510,7 +6637,7 @@ namespace details
                         };
 
                         _WhenAllContinuationWrapper(_PParam, _Func, _ResultTask);
-                    }, _CancellationTokenState::_None());
+                    });
 
                     _Index++;
                 }
@@ -6563,6 +6690,7 @@ namespace details
             }
             else
             {
+                auto _Carrier = _MakeJoinCarrier();
                 for (auto _PTask = _Begin; _PTask != _End; ++_PTask)
                 {
                     if (_PTask->is_apartment_aware())
@@ -6570,10 +6698,10 @@ namespace details
                         _ReturnTask._SetAsync();
                     }
 
-                    _PTask->_Then([_PParam](task<void> _ResultTask) {
+                    _AddJoinContinuation(*_PTask, _Carrier, [_PParam](task<void>& _ResultTask) {
                         auto _Func = [](){};
                         _WhenAllContinuationWrapper(_PParam, _Func, _ResultTask);
-                    }, _CancellationTokenState::_None());
+                    });
                 }
             }
 
@@ -6618,7 +6746,8 @@ namespace details
         {
             _ReturnTask._SetAsync();
         }
-        _VectorTask._Then([_PParam](task<std::vector<_ReturnType>> _ResultTask) {
+        auto _Carrier = _MakeJoinCarrier();
+        _AddJoinContinuation(_VectorTask, _Carrier, [_PParam](task<std::vector<_ReturnType>>& _ResultTask) {
             auto _PParamCopy = _PParam;
             auto _Func = [_PParamCopy, &_ResultTask]() {
                 auto _ResultLocal = _ResultTask._GetImpl()->_GetResult();
@@ -6626,8 +6755,8 @@ namespace details
             };
 
             _WhenAllContinuationWrapper(_PParam, _Func, _ResultTask);
-        }, _CancellationTokenState::_None());
-        _ValueTask._Then([_PParam](task<_ReturnType> _ResultTask) {
+        });
+        _AddJoinContinuation(_ValueTask, _Carrier, [_PParam](task<_ReturnType>& _ResultTask) {
             auto _PParamCopy = _PParam;
             auto _Func = [_PParamCopy, &_ResultTask]() {
                 auto _ResultLocal = _ResultTask._GetImpl()->_GetResult();
@@ -6635,7 +6764,7 @@ namespace details
             };
 
             _WhenAllContinuationWrapper(_PParam, _Func, _ResultTask);
-        }, _CancellationTokenState::_None());
+        });
 
         return _ReturnTask;
     }
@@ -6934,6 +7063,7 @@ namespace details
             auto _CancellationSource = _PParam->_M_cancellationSource;
 
             _PParam->_M_numTasks = static_cast<size_t>(std::distance(_Begin, _End));
+            auto _Carrier = _MakeJoinCarrier();
             size_t _Index = 0;
             for (auto _PTask = _Begin; _PTask != _End; ++_PTask)
             {
@@ -6942,7 +7072,7 @@ namespace details
                     _Any_tasks_completed._SetAsync();
                 }
 
-                _PTask->_Then([_PParam, _Index](task<_ElementType> _ResultTask) {
+                _AddJoinContinuation(*_PTask, _Carrier, [_PParam, _Index](task<_ElementType>& _ResultTask) {
                     auto _PParamCopy = _PParam; // Dev10
                     auto _IndexCopy = _Index; // Dev10
                     auto _Func = [&_ResultTask, _PParamCopy, _IndexCopy]() {
@@ -6950,7 +7080,7 @@ namespace details
                     };
 
                     _WhenAnyContinuationWrapper(_PParam, _Func, _ResultTask);
-                }, _CancellationTokenState::_None());
+                });
 
                 _Index++;
             }
@@ -6994,6 +7124,7 @@ namespace details
             auto _CancellationSource = _PParam->_M_cancellationSource;
 
             _PParam->_M_numTasks = static_cast<size_t>(std::distance(_Begin, _End));
+            auto _Carrier = _MakeJoinCarrier();
             size_t _Index = 0;
             for (auto _PTask = _Begin; _PTask != _End; ++_PTask)
             {
@@ -7002,14 +7133,14 @@ namespace details
                     _Any_tasks_completed._SetAsync();
                 }
 
-                _PTask->_Then([_PParam, _Index](task<void> _ResultTask) {
+                _AddJoinContinuation(*_PTask, _Carrier, [_PParam, _Index](task<void>& _ResultTask) {
                     auto _PParamCopy = _PParam; // Dev10
                     auto _IndexCopy = _Index; // Dev10
                     auto _Func = [&_ResultTask, _PParamCopy, _IndexCopy]() {
                         _PParamCopy->_M_Completed.set(std::make_pair(_IndexCopy, _ResultTask._GetImpl()->_M_pTokenState));
                     };
                     _WhenAnyContinuationWrapper(_PParam, _Func, _ResultTask);
-                }, _CancellationTokenState::_None());
+                });
 
                 _Index++;
             }
@@ -29,6 +29,8 @@
 #endif
 
 #include "cpprest/details/cpprest_compat.h"
+#include <chrono>
+#include <string>
 
 namespace crossplat {
 
@@ -49,11 +51,75 @@ template<class T>
 using java_local_ref = std::unique_ptr<typename std::remove_pointer<T>::type, java_local_ref_deleter>;
 #endif
 
+/// <summary>
+/// Options controlling the size and the threads of a thread pool.
+/// </summary>
+struct threadpool_options
+{
+    threadpool_options()
+        : min_threads(0), max_threads(0), cpu_affinity(false), idle_timeout(std::chrono::seconds(60))
+    {
+    }
+
+    /// <summary>
+    /// The number of threads started with the pool, 0 for the number of hardware threads.
+    /// </summary>
+    size_t min_threads;
+
+    /// <summary>
+    /// The number of threads the pool may grow to while all of its threads are busy running
+    /// functions passed to <c>threadpool::run</c>, 0 for a pool of fixed size.
+    /// </summary>
+    size_t max_threads;
+
+    /// <summary>
+    /// Prefix of the thread names, followed by the index of the thread. Empty to leave threads unnamed.
+    /// Linux truncates thread names to 15 characters.
+    /// </summary>
+    std::string thread_name;
+
+    /// <summary>
+    /// Pins each thread to a single CPU, assigned round robin. Only supported on Linux.
+    /// </summary>
+    bool cpu_affinity;
+
+    /// <summary>
+    /// How long threads above <c>min_threads</c> may stay idle before the pool shrinks again.
+    /// </summary>
+    std::chrono::milliseconds idle_timeout;
+};
+
 class threadpool
 {
 public:
+    /// <summary>
+    /// The pool running asynchronous I/O, and pplx tasks unless a separate compute pool has been initialized.
+    /// </summary>
     static threadpool& shared_instance();
+
+    /// <summary>
+    /// The pool running pplx tasks.
+    /// </summary>
+    _ASYNCRTIMP static threadpool& __cdecl compute_instance();
+
+    /// <summary>
+    /// Sets the number of threads of the shared pool. Throws if the shared pool is already in use.
+    /// </summary>
+    _ASYNCRTIMP static void __cdecl initialize_with_threads(size_t num_threads);
+
+    /// <summary>
+    /// Configures the shared pool, which then also runs pplx tasks. Throws if the shared pool is already in use.
+    /// </summary>
+    _ASYNCRTIMP static void __cdecl initialize(const threadpool_options &options);
+
+    /// <summary>
+    /// Configures separate pools for asynchronous I/O and for pplx tasks, so that blocking continuations cannot
+    /// starve the I/O. Throws if the shared pool is already in use.
+    /// </summary>
+    _ASYNCRTIMP static void __cdecl initialize(const threadpool_options &io_options, const threadpool_options &compute_options);
+
     _ASYNCRTIMP static std::unique_ptr<threadpool> __cdecl construct(size_t num_threads);
+    _ASYNCRTIMP static std::unique_ptr<threadpool> __cdecl construct(const threadpool_options &options);
 
     virtual ~threadpool() = default;
 
@@ -64,12 +130,28 @@ public:
         service().post(task);
     }
 
+    /// <summary>
+    /// Runs a function on the pool. A pool which can grow adds a thread when the work it has queued, including
+    /// handlers posted directly to <c>service()</c>, waits for longer than a tick while no function passed to
+    /// <c>run</c> starts.
+    /// </summary>
+    virtual void run(void (*proc)(void*), void* param)
+    {
+        m_service.post([proc, param]() { proc(param); });
+    }
+
+    /// <summary>
+    /// The current number of threads.
+    /// </summary>
+    virtual size_t size() const { return m_num_threads; }
+
     boost::asio::io_service& service() { return m_service; }
 
 protected:
-    threadpool(size_t num_threads) : m_service(num_threads) {}
+    threadpool(size_t num_threads) : m_service(num_threads), m_num_threads(num_threads) {}
 
     boost::asio::io_service m_service;
+    size_t m_num_threads;
 };
 
 }
@@ -0,0 +1,220 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* HTTP Library: Newline delimited JSON (NDJSON) reader
+*
+* For the latest on this and related APIs, please see: https://github.com/Microsoft/cpprestsdk
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+
+#include "stdafx.h"
+#include <deque>
+#include "cpprest/json_ndjson.h"
+
+using namespace web;
+using namespace web::json;
+
+namespace web { namespace json { namespace details {
+
+class _ndjson_reader_impl : public std::enable_shared_from_this<_ndjson_reader_impl>
+{
+public:
+    typedef pplx::task<std::shared_ptr<ndjson_batch>> batch_task;
+
+    _ndjson_reader_impl(concurrency::streams::istream input, bool ordered, size_t batch_size, size_t max_parallel_batches)
+        : m_input(std::move(input)),
+          m_ordered(ordered),
+          m_batch_size(batch_size == 0 ? ndjson_reader::default_batch_size : batch_size),
+          m_max_parallel(max_parallel_batches),
+          m_next_sequence(0),
+          m_eof(false)
+    {
+        if (m_max_parallel == 0)
+        {
+            m_max_parallel = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        m_read_buffer.resize(std::min(m_batch_size, static_cast<size_t>(64 * 1024)));
+    }
+
+    pplx::task<bool> move_next()
+    {
+        auto self = shared_from_this();
+        return fill().then([self]() -> pplx::task<bool>
+        {
+            if (self->m_batches.empty())
+            {
+                return pplx::task_from_result(false);
+            }
+
+            batch_task ready;
+            if (self->m_ordered)
+            {
+                ready = self->m_batches.front();
+                self->m_batches.pop_front();
+            }
+            else
+            {
+                ready = pplx::when_any(self->m_batches.begin(), self->m_batches.end()).then([self](std::pair<std::shared_ptr<ndjson_batch>, size_t> result)
+                {
+                    self->m_batches.erase(self->m_batches.begin() + result.second);
+                    return result.first;
+                });
+            }
+
+            return ready.then([self](std::shared_ptr<ndjson_batch> batch)
+            {
+                self->m_current = std::move(*batch);
+                return true;
+            });
+        });
+    }
+
+    ndjson_batch &current()
+    {
+        return m_current;
+    }
+
+    pplx::task<void> for_each(std::function<void(ndjson_batch &)> handler)
+    {
+        auto self = shared_from_this();
+        return move_next().then([self, handler](bool available) -> pplx::task<void>
+        {
+            if (!available)
+            {
+                return pplx::task_from_result();
+            }
+            handler(self->m_current);
+            return self->for_each(handler);
+        });
+    }
+
+private:
+    // Keeps reading until max_parallel batches are being parsed or the input ends.
+    pplx::task<void> fill()
+    {
+        if (m_eof || m_batches.size() >= m_max_parallel)
+        {
+            return pplx::task_from_result();
+        }
+
+        auto self = shared_from_this();
+        return read_batch().then([self]()
+        {
+            return self->fill();
+        });
+    }
+
+    // Reads until at least batch size bytes of whole lines are available, then starts parsing them.
+    pplx::task<void> read_batch()
+    {
+        auto self = shared_from_this();
+        return m_input.streambuf().getn(&m_read_buffer[0], m_read_buffer.size()).then([self](size_t count) -> pplx::task<void>
+        {
+            if (count == 0)
+            {
+                self->m_eof = true;
+                if (!self->m_text.empty())
+                {
+                    self->start_batch();
+                }
+                return pplx::task_from_result();
+            }
+
+            self->m_text.append(reinterpret_cast<const char *>(&self->m_read_buffer[0]), count);
+            if (self->m_text.size() < self->m_batch_size)
+            {
+                return self->read_batch();
+            }
+
+            const auto last = self->m_text.rfind('\n');
+            if (last == std::string::npos)
+            {
+                // A single line longer than the batch size, keep reading until it ends.
+                return self->read_batch();
+            }
+
+            std::string rest = self->m_text.substr(last + 1);
+            self->m_text.resize(last + 1);
+            self->start_batch();
+            self->m_text = std::move(rest);
+            return pplx::task_from_result();
+        });
+    }
+
+    void start_batch()
+    {
+        auto text = std::make_shared<std::string>(std::move(m_text));
+        const auto sequence = m_next_sequence++;
+        m_text.clear();
+
+        m_batches.push_back(pplx::create_task([text, sequence]()
+        {
+            return parse_batch(*text, sequence);
+        }));
+    }
+
+    static std::shared_ptr<ndjson_batch> parse_batch(const std::string &text, size_t sequence)
+    {
+        auto batch = std::make_shared<ndjson_batch>();
+        batch->sequence = sequence;
+
+        size_t begin = 0;
+        while (begin < text.size())
+        {
+            auto end = text.find('\n', begin);
+            if (end == std::string::npos)
+            {
+                end = text.size();
+            }
+
+            // Blank lines are skipped, the parser itself ignores a trailing carriage return.
+            const auto first = text.find_first_not_of(" \t\r", begin);
+            if (first != std::string::npos && first < end)
+            {
+                batch->records.push_back(json::value::parse(utility::conversions::to_string_t(text.substr(first, end - first))));
+            }
+            begin = end + 1;
+        }
+
+        return batch;
+    }
+
+    concurrency::streams::istream m_input;
+    bool m_ordered;
+    size_t m_batch_size;
+    size_t m_max_parallel;
+
+    std::vector<uint8_t> m_read_buffer;
+    std::string m_text;
+    size_t m_next_sequence;
+    bool m_eof;
+
+    std::deque<batch_task> m_batches;
+    ndjson_batch m_current;
+};
+
+}}}
+
+ndjson_reader::ndjson_reader(concurrency::streams::istream input, bool ordered, size_t batch_size, size_t max_parallel_batches)
+    : m_impl(std::make_shared<details::_ndjson_reader_impl>(std::move(input), ordered, batch_size, max_parallel_batches))
+{
+}
+
+pplx::task<bool> ndjson_reader::move_next()
+{
+    return m_impl->move_next();
+}
+
+ndjson_batch &ndjson_reader::current()
+{
+    return m_impl->current();
+}
+
+pplx::task<void> ndjson_reader::for_each(std::function<void(ndjson_batch &)> handler)
+{
+    return m_impl->for_each(std::move(handler));
+}
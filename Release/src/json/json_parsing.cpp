@@ -13,6 +13,7 @@
 
 #include "stdafx.h"
 #include <cstdlib>
+#include "cpprest/json_binding.h"
 
 #if defined(_MSC_VER)
 #pragma warning(disable : 4127) // allow expressions like while(true) pass
@@ -1298,3 +1299,255 @@ web::json::value web::json::value::parse(std::istream& stream, std::error_code&
     return _parse_narrow_stream(stream, error);
 }
 #endif
+
+//
+// Pull based reader
+//
+
+namespace web { namespace json { namespace details
+{
+struct _json_reader_impl
+{
+    enum state
+    {
+        expect_value,
+        expect_value_or_end,
+        expect_name,
+        expect_name_or_end,
+        expect_separator,
+        expect_end_of_input,
+        at_end_of_input
+    };
+
+    explicit _json_reader_impl(const utility::string_t &text)
+        : m_parser(text), m_state(expect_value)
+    {
+    }
+
+#ifndef _WIN32
+    // Numbers are converted by the C library, so the reader holds the C locale on its thread for as long as it lives
+    // instead of switching it for every token.
+    utility::details::scoped_c_thread_locale m_locale;
+#endif
+    JSON_StringParser<utility::char_t> m_parser;
+    JSON_Parser<utility::char_t>::Token m_token;
+    // One entry per open container, true for objects.
+    std::vector<bool> m_containers;
+    state m_state;
+};
+}}}
+
+json_reader::json_reader(const utility::string_t &text)
+    : m_impl(utility::details::make_unique<details::_json_reader_impl>(text)),
+      m_kind(end_of_input),
+      m_signed(false),
+      m_boolean(false),
+      m_int64(0),
+      m_uint64(0),
+      m_double(0)
+{
+}
+
+json_reader::~json_reader()
+{
+}
+
+json_reader::token_kind json_reader::read()
+{
+    typedef details::JSON_Parser<utility::char_t>::Token Token;
+    typedef details::_json_reader_impl impl;
+
+    auto &token = m_impl->m_token;
+    auto &containers = m_impl->m_containers;
+    auto &state = m_impl->m_state;
+
+    if (state == impl::at_end_of_input)
+    {
+        return m_kind = end_of_input;
+    }
+
+    auto next_token = [this, &token]()
+    {
+        m_impl->m_parser.GetNextToken(token);
+        if (token.m_error)
+        {
+            details::CreateException(token, utility::conversions::to_string_t(token.m_error.message()));
+        }
+    };
+
+    next_token();
+    if (state == impl::expect_separator)
+    {
+        const bool in_object = containers.back();
+        if (token.kind == Token::TKN_Comma)
+        {
+            state = in_object ? impl::expect_name : impl::expect_value;
+            next_token();
+        }
+        else if (token.kind == (in_object ? Token::TKN_CloseBrace : Token::TKN_CloseBracket))
+        {
+            state = in_object ? impl::expect_name_or_end : impl::expect_value_or_end;
+        }
+        else
+        {
+            details::CreateException(token, in_object ? _XPLATSTR("Expected ',' or '}'") : _XPLATSTR("Expected ',' or ']'"));
+        }
+    }
+
+    switch (state)
+    {
+    case impl::expect_end_of_input:
+        if (token.kind != Token::TKN_EOF)
+        {
+            details::CreateException(token, _XPLATSTR("Left-over characters in stream after parsing a JSON value"));
+        }
+        state = impl::at_end_of_input;
+        return m_kind = end_of_input;
+
+    case impl::expect_name_or_end:
+        if (token.kind == Token::TKN_CloseBrace)
+        {
+            m_kind = end_object;
+            break;
+        }
+        // fall through
+    case impl::expect_name:
+        if (token.kind != Token::TKN_StringLiteral)
+        {
+            details::CreateException(token, _XPLATSTR("Expected an object member name"));
+        }
+        m_text = std::move(token.string_val);
+        next_token();
+        if (token.kind != Token::TKN_Colon)
+        {
+            details::CreateException(token, _XPLATSTR("Expected ':'"));
+        }
+        state = impl::expect_value;
+        return m_kind = property_name;
+
+    case impl::expect_value_or_end:
+        if (token.kind == Token::TKN_CloseBracket)
+        {
+            m_kind = end_array;
+            break;
+        }
+        // fall through
+    default:
+        switch (token.kind)
+        {
+        case Token::TKN_OpenBrace:
+            containers.push_back(true);
+            state = impl::expect_name_or_end;
+            return m_kind = begin_object;
+        case Token::TKN_OpenBracket:
+            containers.push_back(false);
+            state = impl::expect_value_or_end;
+            return m_kind = begin_array;
+        case Token::TKN_StringLiteral:
+            m_text = std::move(token.string_val);
+            m_kind = string_value;
+            break;
+        case Token::TKN_IntegerLiteral:
+            m_signed = token.signed_number;
+            if (m_signed)
+            {
+                m_int64 = token.int64_val;
+                m_double = static_cast<double>(m_int64);
+            }
+            else
+            {
+                m_uint64 = token.uint64_val;
+                m_double = static_cast<double>(m_uint64);
+            }
+            m_kind = integer_value;
+            break;
+        case Token::TKN_NumberLiteral:
+            m_double = token.double_val;
+            m_kind = number_value;
+            break;
+        case Token::TKN_BooleanLiteral:
+            m_boolean = token.boolean_val;
+            m_kind = boolean_value;
+            break;
+        case Token::TKN_NullLiteral:
+            m_kind = null_value;
+            break;
+        default:
+            details::CreateException(token, _XPLATSTR("Expected a value"));
+        }
+        state = containers.empty() ? impl::expect_end_of_input : impl::expect_separator;
+        return m_kind;
+    }
+
+    // A container was closed.
+    containers.pop_back();
+    state = containers.empty() ? impl::expect_end_of_input : impl::expect_separator;
+    return m_kind;
+}
+
+void json_reader::skip()
+{
+    if (m_kind != begin_object && m_kind != begin_array)
+    {
+        return;
+    }
+
+    const auto depth = m_impl->m_containers.size();
+    while (read() != end_of_input && m_impl->m_containers.size() >= depth)
+    {
+    }
+}
+
+void json_reader::fail(const utility::string_t &message) const
+{
+    details::CreateException(m_impl->m_token, message);
+}
+
+void web::json::details::_bind_from_reader(json_reader &reader, json::value &target)
+{
+    switch (reader.kind())
+    {
+    case json_reader::begin_object:
+        {
+            std::vector<std::pair<utility::string_t, json::value>> fields;
+            while (reader.read() != json_reader::end_object)
+            {
+                utility::string_t name = reader.text();
+                json::value field;
+                reader.read();
+                _bind_from_reader(reader, field);
+                fields.emplace_back(std::move(name), std::move(field));
+            }
+            target = json::value::object(std::move(fields), g_keep_json_object_unsorted);
+            break;
+        }
+    case json_reader::begin_array:
+        {
+            std::vector<json::value> elements;
+            while (reader.read() != json_reader::end_array)
+            {
+                elements.emplace_back();
+                _bind_from_reader(reader, elements.back());
+            }
+            target = json::value::array(std::move(elements));
+            break;
+        }
+    case json_reader::string_value:
+        target = json::value::string(reader.text());
+        break;
+    case json_reader::integer_value:
+        target = reader.is_signed() ? json::value::number(reader.as_int64()) : json::value::number(reader.as_uint64());
+        break;
+    case json_reader::number_value:
+        target = json::value::number(reader.as_double());
+        break;
+    case json_reader::boolean_value:
+        target = json::value::boolean(reader.as_bool());
+        break;
+    case json_reader::null_value:
+        target = json::value::null();
+        break;
+    default:
+        reader.fail(_XPLATSTR("Expected a value"));
+    }
+}
@@ -0,0 +1,448 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* HTTP Library: JSON Pointer (RFC 6901) and JSONPath queries over JSON values
+*
+* For the latest on this and related APIs, please see: https://github.com/Microsoft/cpprestsdk
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+
+#include "stdafx.h"
+#include "cpprest/json_pointer.h"
+
+using namespace web;
+using namespace web::json;
+using namespace utility;
+
+namespace
+{
+// Parses a non-negative decimal integer without sign or leading zeros, returns -1 if the text is not one.
+int64_t parse_array_index(const utility::string_t &text)
+{
+    if (text.empty() || text.size() > 18 || (text.size() > 1 && text[0] == '0'))
+    {
+        return -1;
+    }
+
+    int64_t result = 0;
+    for (const auto ch : text)
+    {
+        if (ch < '0' || ch > '9')
+        {
+            return -1;
+        }
+        result = result * 10 + (ch - '0');
+    }
+    return result;
+}
+
+// Appends a node and all of its descendants, in document order.
+void collect_descendants(const json::value &root, std::vector<const json::value *> &out)
+{
+    std::vector<const json::value *> pending(1, &root);
+    while (!pending.empty())
+    {
+        const json::value *node = pending.back();
+        pending.pop_back();
+        out.push_back(node);
+
+        if (node->is_object())
+        {
+            const auto &obj = node->as_object();
+            for (auto iter = obj.rbegin(); iter != obj.rend(); ++iter)
+            {
+                pending.push_back(&iter->second);
+            }
+        }
+        else if (node->is_array())
+        {
+            const auto &arr = node->as_array();
+            for (auto iter = arr.rbegin(); iter != arr.rend(); ++iter)
+            {
+                pending.push_back(&*iter);
+            }
+        }
+    }
+}
+}
+
+//
+// JSON Pointer
+//
+
+json_pointer::json_pointer()
+{
+}
+
+json_pointer::json_pointer(const utility::string_t &pointer)
+{
+    if (pointer.empty())
+    {
+        return;
+    }
+    if (pointer[0] != '/')
+    {
+        throw json_exception(_XPLATSTR("A JSON pointer must be empty or start with '/'"));
+    }
+
+    utility::string_t token;
+    for (size_t pos = 1; pos <= pointer.size(); ++pos)
+    {
+        if (pos == pointer.size() || pointer[pos] == '/')
+        {
+            m_indices.push_back(parse_array_index(token));
+            m_tokens.push_back(std::move(token));
+            token.clear();
+        }
+        else if (pointer[pos] == '~')
+        {
+            if (pos + 1 == pointer.size() || (pointer[pos + 1] != '0' && pointer[pos + 1] != '1'))
+            {
+                throw json_exception(_XPLATSTR("Invalid escape sequence in JSON pointer"));
+            }
+            token.push_back(pointer[++pos] == '0' ? '~' : '/');
+        }
+        else
+        {
+            token.push_back(pointer[pos]);
+        }
+    }
+}
+
+const json::value *json_pointer::find(const json::value &root) const
+{
+    const json::value *current = &root;
+    for (size_t i = 0; i < m_tokens.size(); ++i)
+    {
+        if (current->is_object())
+        {
+            const auto &obj = current->as_object();
+            auto iter = obj.find(m_tokens[i]);
+            if (iter == obj.end())
+            {
+                return nullptr;
+            }
+            current = &iter->second;
+        }
+        else if (current->is_array())
+        {
+            const auto &arr = current->as_array();
+            if (m_indices[i] < 0 || static_cast<uint64_t>(m_indices[i]) >= arr.size())
+            {
+                return nullptr;
+            }
+            current = &arr.at(static_cast<size_t>(m_indices[i]));
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+    return current;
+}
+
+json::value *json_pointer::find(json::value &root) const
+{
+    // The result is a part of root, which the caller is allowed to modify.
+    return const_cast<json::value *>(find(static_cast<const json::value &>(root)));
+}
+
+const json::value &json_pointer::at(const json::value &root) const
+{
+    const json::value *result = find(root);
+    if (result == nullptr)
+    {
+        throw json_exception(_XPLATSTR("JSON pointer does not refer to a value"));
+    }
+    return *result;
+}
+
+utility::string_t json_pointer::to_string() const
+{
+    utility::string_t result;
+    for (const auto &token : m_tokens)
+    {
+        result.push_back('/');
+        for (const auto ch : token)
+        {
+            if (ch == '~')
+            {
+                result.append(_XPLATSTR("~0"));
+            }
+            else if (ch == '/')
+            {
+                result.append(_XPLATSTR("~1"));
+            }
+            else
+            {
+                result.push_back(ch);
+            }
+        }
+    }
+    return result;
+}
+
+//
+// JSONPath
+//
+
+namespace
+{
+bool parse_integer(const utility::string_t &expression, size_t &pos, int64_t &result)
+{
+    const size_t start = pos;
+    bool negative = false;
+    if (pos < expression.size() && expression[pos] == '-')
+    {
+        negative = true;
+        ++pos;
+    }
+
+    int64_t value = 0;
+    size_t digits = 0;
+    while (pos < expression.size() && expression[pos] >= '0' && expression[pos] <= '9' && digits < 18)
+    {
+        value = value * 10 + (expression[pos++] - '0');
+        ++digits;
+    }
+
+    if (digits == 0)
+    {
+        pos = start;
+        return false;
+    }
+    result = negative ? -value : value;
+    return true;
+}
+
+void throw_path_error()
+{
+    throw json_exception(_XPLATSTR("Malformed or unsupported JSONPath expression"));
+}
+}
+
+json_path::json_path(const utility::string_t &expression)
+{
+    if (expression.empty() || expression[0] != '$')
+    {
+        throw_path_error();
+    }
+
+    size_t pos = 1;
+    while (pos < expression.size())
+    {
+        step s;
+        s.m_kind = member_step;
+        s.m_recursive = false;
+        s.m_index = 0;
+        s.m_end = 0;
+        s.m_has_index = false;
+        s.m_has_end = false;
+
+        bool bracket = expression[pos] == '[';
+        if (!bracket)
+        {
+            if (expression[pos] != '.')
+            {
+                throw_path_error();
+            }
+            ++pos;
+            if (pos < expression.size() && expression[pos] == '.')
+            {
+                s.m_recursive = true;
+                ++pos;
+            }
+
+            if (pos < expression.size() && expression[pos] == '*')
+            {
+                s.m_kind = wildcard_step;
+                ++pos;
+            }
+            else if (s.m_recursive && pos < expression.size() && expression[pos] == '[')
+            {
+                bracket = true;
+            }
+            else
+            {
+                const size_t start = pos;
+                while (pos < expression.size() && expression[pos] != '.' && expression[pos] != '[')
+                {
+                    ++pos;
+                }
+                if (pos == start)
+                {
+                    throw_path_error();
+                }
+                s.m_name = expression.substr(start, pos - start);
+            }
+        }
+
+        if (bracket)
+        {
+            ++pos;
+            if (pos >= expression.size())
+            {
+                throw_path_error();
+            }
+
+            const auto ch = expression[pos];
+            if (ch == '\'' || ch == '"')
+            {
+                ++pos;
+                while (pos < expression.size() && expression[pos] != ch)
+                {
+                    if (expression[pos] == '\\' && pos + 1 < expression.size())
+                    {
+                        ++pos;
+                    }
+                    s.m_name.push_back(expression[pos++]);
+                }
+                if (pos >= expression.size())
+                {
+                    throw_path_error();
+                }
+                ++pos;
+            }
+            else if (ch == '*')
+            {
+                s.m_kind = wildcard_step;
+                ++pos;
+            }
+            else
+            {
+                s.m_kind = index_step;
+                s.m_has_index = parse_integer(expression, pos, s.m_index);
+                if (pos < expression.size() && expression[pos] == ':')
+                {
+                    s.m_kind = slice_step;
+                    ++pos;
+                    s.m_has_end = parse_integer(expression, pos, s.m_end);
+                }
+                else if (!s.m_has_index)
+                {
+                    throw_path_error();
+                }
+            }
+
+            if (pos >= expression.size() || expression[pos] != ']')
+            {
+                throw_path_error();
+            }
+            ++pos;
+        }
+
+        m_steps.push_back(std::move(s));
+    }
+}
+
+void json_path::apply(const step &s, const json::value &node, std::vector<const json::value *> &out) const
+{
+    switch (s.m_kind)
+    {
+    case member_step:
+        if (node.is_object())
+        {
+            const auto &obj = node.as_object();
+            auto iter = obj.find(s.m_name);
+            if (iter != obj.end())
+            {
+                out.push_back(&iter->second);
+            }
+        }
+        break;
+    case wildcard_step:
+        if (node.is_object())
+        {
+            for (const auto &field : node.as_object())
+            {
+                out.push_back(&field.second);
+            }
+        }
+        else if (node.is_array())
+        {
+            for (const auto &element : node.as_array())
+            {
+                out.push_back(&element);
+            }
+        }
+        break;
+    case index_step:
+        if (node.is_array())
+        {
+            const auto &arr = node.as_array();
+            const auto size = static_cast<int64_t>(arr.size());
+            const auto index = s.m_index < 0 ? s.m_index + size : s.m_index;
+            if (index >= 0 && index < size)
+            {
+                out.push_back(&arr.at(static_cast<size_t>(index)));
+            }
+        }
+        break;
+    case slice_step:
+        if (node.is_array())
+        {
+            const auto &arr = node.as_array();
+            const auto size = static_cast<int64_t>(arr.size());
+            auto begin = s.m_has_index ? s.m_index : 0;
+            auto end = s.m_has_end ? s.m_end : size;
+            if (begin < 0)
+            {
+                begin = std::max<int64_t>(begin + size, 0);
+            }
+            if (end < 0)
+            {
+                end = std::max<int64_t>(end + size, 0);
+            }
+            end = std::min(end, size);
+            for (auto i = begin; i < end; ++i)
+            {
+                out.push_back(&arr.at(static_cast<size_t>(i)));
+            }
+        }
+        break;
+    }
+}
+
+std::vector<const json::value *> json_path::evaluate(const json::value &root) const
+{
+    std::vector<const json::value *> current(1, &root);
+    std::vector<const json::value *> next;
+    std::vector<const json::value *> descendants;
+
+    for (const auto &s : m_steps)
+    {
+        next.clear();
+        for (const auto node : current)
+        {
+            if (s.m_recursive)
+            {
+                descendants.clear();
+                collect_descendants(*node, descendants);
+                for (const auto descendant : descendants)
+                {
+                    apply(s, *descendant, next);
+                }
+            }
+            else
+            {
+                apply(s, *node, next);
+            }
+        }
+        current.swap(next);
+        if (current.empty())
+        {
+            break;
+        }
+    }
+    return current;
+}
+
+const json::value *json_path::find(const json::value &root) const
+{
+    auto results = evaluate(root);
+    return results.empty() ? nullptr : results.front();
+}
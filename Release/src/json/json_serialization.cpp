@@ -13,6 +13,7 @@
 
 #include "stdafx.h"
 #include <stdio.h>
+#include "cpprest/json_writer.h"
 
 #ifndef _WIN32
 #define __STDC_FORMAT_MACROS
@@ -147,48 +148,73 @@ void web::json::details::_String::format(std::basic_string<char>& str) const
     str.push_back('"');
 }
 
-void web::json::details::_Number::format(std::basic_string<char>& stream) const
+namespace
 {
-    if(m_number.m_type != number::type::double_type)
-    {
-        // #digits + 1 to avoid loss + 1 for the sign + 1 for null terminator.
-        const size_t tempSize = std::numeric_limits<uint64_t>::digits10 + 3;
-        char tempBuffer[tempSize];
+void format_integer(std::basic_string<char>& stream, int64_t value)
+{
+    // #digits + 1 to avoid loss + 1 for the sign + 1 for null terminator.
+    const size_t tempSize = std::numeric_limits<uint64_t>::digits10 + 3;
+    char tempBuffer[tempSize];
 
 #ifdef _WIN32
-        // This can be improved performance-wise if we implement our own routine
-        if (m_number.m_type == number::type::signed_type)
-            _i64toa_s(m_number.m_intval, tempBuffer, tempSize, 10);
-        else
-            _ui64toa_s(m_number.m_uintval, tempBuffer, tempSize, 10);
+    // This can be improved performance-wise if we implement our own routine
+    _i64toa_s(value, tempBuffer, tempSize, 10);
+    const auto numChars = strnlen_s(tempBuffer, tempSize);
+#else
+    const int numChars = snprintf(tempBuffer, tempSize, "%" PRId64, value);
+#endif
+    stream.append(tempBuffer, numChars);
+}
 
-        const auto numChars = strnlen_s(tempBuffer, tempSize);
+void format_integer(std::basic_string<char>& stream, uint64_t value)
+{
+    // #digits + 1 to avoid loss + 1 for the sign + 1 for null terminator.
+    const size_t tempSize = std::numeric_limits<uint64_t>::digits10 + 3;
+    char tempBuffer[tempSize];
+
+#ifdef _WIN32
+    _ui64toa_s(value, tempBuffer, tempSize, 10);
+    const auto numChars = strnlen_s(tempBuffer, tempSize);
 #else
-        int numChars;
-        if (m_number.m_type == number::type::signed_type)
-            numChars = snprintf(tempBuffer, tempSize, "%" PRId64, m_number.m_intval);
-        else
-            numChars = snprintf(tempBuffer, tempSize, "%" PRIu64, m_number.m_uintval);
+    const int numChars = snprintf(tempBuffer, tempSize, "%" PRIu64, value);
 #endif
-        stream.append(tempBuffer, numChars);
-    }
-    else
-    {
-        // #digits + 2 to avoid loss + 1 for the sign + 1 for decimal point + 5 for exponent (e+xxx) + 1 for null terminator
-        const size_t tempSize = std::numeric_limits<double>::digits10 + 10;
-        char tempBuffer[tempSize];
+    stream.append(tempBuffer, numChars);
+}
+
+// The C locale must be in effect for the calling thread.
+void format_double(std::basic_string<char>& stream, double value)
+{
+    // #digits + 2 to avoid loss + 1 for the sign + 1 for decimal point + 5 for exponent (e+xxx) + 1 for null terminator
+    const size_t tempSize = std::numeric_limits<double>::digits10 + 10;
+    char tempBuffer[tempSize];
 #ifdef _WIN32
-        const auto numChars = _sprintf_s_l(
-            tempBuffer,
-            tempSize,
-            "%.*g",
-            utility::details::scoped_c_thread_locale::c_locale(),
-            std::numeric_limits<double>::digits10 + 2,
-            m_number.m_value);
+    const auto numChars = _sprintf_s_l(
+        tempBuffer,
+        tempSize,
+        "%.*g",
+        utility::details::scoped_c_thread_locale::c_locale(),
+        std::numeric_limits<double>::digits10 + 2,
+        value);
 #else
-        const auto numChars = snprintf(tempBuffer, tempSize, "%.*g", std::numeric_limits<double>::digits10 + 2, m_number.m_value);
+    const auto numChars = snprintf(tempBuffer, tempSize, "%.*g", std::numeric_limits<double>::digits10 + 2, value);
 #endif
-        stream.append(tempBuffer, numChars);
+    stream.append(tempBuffer, numChars);
+}
+}
+
+void web::json::details::_Number::format(std::basic_string<char>& stream) const
+{
+    if (m_number.m_type == number::type::signed_type)
+    {
+        format_integer(stream, m_number.m_intval);
+    }
+    else if (m_number.m_type == number::type::unsigned_type)
+    {
+        format_integer(stream, m_number.m_uintval);
+    }
+    else
+    {
+        format_double(stream, m_number.m_value);
     }
 }
 
@@ -260,3 +286,281 @@ utility::string_t json::value::serialize() const
 #endif
     return m_value->to_string();
 }
+
+//
+// Streaming JSON writer
+//
+
+web::json::json_writer::json_writer(concurrency::streams::streambuf<uint8_t> buffer, size_t chunk_size)
+    : m_buffer(std::move(buffer)),
+      m_stream(nullptr),
+      m_chunk_size(chunk_size == 0 ? 1 : chunk_size),
+      m_pending(pplx::task_from_result()),
+      m_expect_value(false),
+      m_complete(false)
+{
+    if (!m_buffer.can_write())
+    {
+        throw std::invalid_argument("stream buffer not set up for output of data");
+    }
+    m_chunk.reserve(m_chunk_size);
+}
+
+web::json::json_writer::json_writer(std::ostream &stream, size_t chunk_size)
+    : m_stream(&stream),
+      m_chunk_size(chunk_size == 0 ? 1 : chunk_size),
+      m_pending(pplx::task_from_result()),
+      m_expect_value(false),
+      m_complete(false)
+{
+    m_chunk.reserve(m_chunk_size);
+}
+
+web::json::json_writer::~json_writer()
+{
+    // The stream buffer may still be reading the in-flight chunk.
+    try
+    {
+        m_pending.wait();
+    }
+    catch (...)
+    {
+    }
+}
+
+void web::json::json_writer::before_value()
+{
+    if (m_scopes.empty())
+    {
+        if (m_complete)
+        {
+            throw json_exception(_XPLATSTR("A JSON document can only contain one top level value"));
+        }
+        m_complete = true;
+    }
+    else if (m_scopes.back().m_kind == object_scope)
+    {
+        if (!m_expect_value)
+        {
+            throw json_exception(_XPLATSTR("A key must be written before each value of a JSON object"));
+        }
+        m_expect_value = false;
+    }
+    else
+    {
+        if (!m_scopes.back().m_empty)
+        {
+            m_chunk.push_back(',');
+        }
+        m_scopes.back().m_empty = false;
+    }
+}
+
+void web::json::json_writer::begin_object()
+{
+    before_value();
+    m_chunk.push_back('{');
+    scope s = { object_scope, true };
+    m_scopes.push_back(s);
+}
+
+void web::json::json_writer::end_object()
+{
+    if (m_scopes.empty() || m_scopes.back().m_kind != object_scope || m_expect_value)
+    {
+        throw json_exception(_XPLATSTR("No JSON object to end"));
+    }
+    m_scopes.pop_back();
+    m_chunk.push_back('}');
+    flush_if_full();
+}
+
+void web::json::json_writer::begin_array()
+{
+    before_value();
+    m_chunk.push_back('[');
+    scope s = { array_scope, true };
+    m_scopes.push_back(s);
+}
+
+void web::json::json_writer::end_array()
+{
+    if (m_scopes.empty() || m_scopes.back().m_kind != array_scope)
+    {
+        throw json_exception(_XPLATSTR("No JSON array to end"));
+    }
+    m_scopes.pop_back();
+    m_chunk.push_back(']');
+    flush_if_full();
+}
+
+void web::json::json_writer::key(const utility::string_t &name)
+{
+    if (m_scopes.empty() || m_scopes.back().m_kind != object_scope || m_expect_value)
+    {
+        throw json_exception(_XPLATSTR("A key can only be written where a JSON object expects a field"));
+    }
+    if (!m_scopes.back().m_empty)
+    {
+        m_chunk.push_back(',');
+    }
+    m_scopes.back().m_empty = false;
+
+    details::format_string(name, m_chunk);
+    m_chunk.push_back(':');
+    m_expect_value = true;
+    flush_if_full();
+}
+
+void web::json::json_writer::write(const json::value &val)
+{
+#ifndef _WIN32
+    utility::details::scoped_c_thread_locale locale;
+#endif
+    before_value();
+    write_value(val);
+}
+
+void web::json::json_writer::write_value(const json::value &val)
+{
+    switch (val.type())
+    {
+    case json::value::Object:
+    {
+        const auto &obj = val.as_object();
+        m_chunk.push_back('{');
+        for (auto iter = obj.begin(); iter != obj.end(); ++iter)
+        {
+            if (iter != obj.begin())
+            {
+                m_chunk.push_back(',');
+            }
+            details::format_string(iter->first, m_chunk);
+            m_chunk.push_back(':');
+            write_value(iter->second);
+        }
+        m_chunk.push_back('}');
+        break;
+    }
+    case json::value::Array:
+    {
+        const auto &arr = val.as_array();
+        m_chunk.push_back('[');
+        for (auto iter = arr.begin(); iter != arr.end(); ++iter)
+        {
+            if (iter != arr.begin())
+            {
+                m_chunk.push_back(',');
+            }
+            write_value(*iter);
+        }
+        m_chunk.push_back(']');
+        break;
+    }
+    default:
+        val.format(m_chunk);
+        break;
+    }
+    flush_if_full();
+}
+
+void web::json::json_writer::null()
+{
+    before_value();
+    m_chunk.append("null");
+    flush_if_full();
+}
+
+void web::json::json_writer::boolean(bool val)
+{
+    before_value();
+    m_chunk.append(val ? "true" : "false");
+    flush_if_full();
+}
+
+void web::json::json_writer::number(int32_t val)
+{
+    number(static_cast<int64_t>(val));
+}
+
+void web::json::json_writer::number(uint32_t val)
+{
+    number(static_cast<uint64_t>(val));
+}
+
+void web::json::json_writer::number(int64_t val)
+{
+    before_value();
+    format_integer(m_chunk, val);
+    flush_if_full();
+}
+
+void web::json::json_writer::number(uint64_t val)
+{
+    before_value();
+    format_integer(m_chunk, val);
+    flush_if_full();
+}
+
+void web::json::json_writer::number(double val)
+{
+#ifndef _WIN32
+    utility::details::scoped_c_thread_locale locale;
+#endif
+    before_value();
+    format_double(m_chunk, val);
+    flush_if_full();
+}
+
+void web::json::json_writer::string(const utility::string_t &val)
+{
+    before_value();
+    details::format_string(val, m_chunk);
+    flush_if_full();
+}
+
+void web::json::json_writer::write_chunk()
+{
+    if (m_chunk.empty())
+    {
+        return;
+    }
+
+    if (m_stream != nullptr)
+    {
+        m_stream->write(m_chunk.data(), static_cast<std::streamsize>(m_chunk.size()));
+        m_chunk.clear();
+        return;
+    }
+
+    // Only one chunk is in flight at a time, wait for it before reusing its storage.
+    m_pending.get();
+    std::swap(m_chunk, m_inflight);
+    m_chunk.clear();
+
+    const size_t size = m_inflight.size();
+    m_pending = m_buffer.putn_nocopy(reinterpret_cast<const uint8_t *>(&m_inflight[0]), size).then([size](size_t written)
+    {
+        if (written != size)
+        {
+            throw std::runtime_error("failed to write all of the JSON text to the stream buffer");
+        }
+    });
+}
+
+pplx::task<void> web::json::json_writer::flush()
+{
+    write_chunk();
+
+    if (m_stream != nullptr)
+    {
+        m_stream->flush();
+        return pplx::task_from_result();
+    }
+
+    auto buffer = m_buffer;
+    return m_pending.then([buffer]() mutable
+    {
+        return buffer.sync();
+    });
+}
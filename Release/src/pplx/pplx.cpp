@@ -17,6 +17,16 @@
 
 #include "pplx/pplx.h"
 
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+#if defined(CPPREST_PPLX_METRICS)
+#include <atomic>
+#include <mutex>
+#include <vector>
+#endif
+
 // Disable false alarm code analyze warning
 #if defined(_MSC_VER)
 #pragma warning (disable : 26165 26110)
@@ -63,8 +73,289 @@ namespace details
     };
 
     typedef ::pplx::scoped_lock<_Spin_lock> _Scoped_spin_lock;
+
+#if defined(_WIN32)
+    static __declspec(thread) long _S_inline_depth;
+
+    _PPLXIMP long _pplx_cdecl _AdjustInlineDepth(long _Delta)
+    {
+        _S_inline_depth += _Delta;
+        return _S_inline_depth;
+    }
+#else
+    // Android has no thread_local, so the depth is kept in a pthread key.
+    static pthread_key_t _S_inline_depth_key;
+    static pthread_once_t _S_inline_depth_once = PTHREAD_ONCE_INIT;
+
+    static void _Create_inline_depth_key()
+    {
+        pthread_key_create(&_S_inline_depth_key, nullptr);
+    }
+
+    _PPLXIMP long _pplx_cdecl _AdjustInlineDepth(long _Delta)
+    {
+        pthread_once(&_S_inline_depth_once, _Create_inline_depth_key);
+        auto _Depth = reinterpret_cast<intptr_t>(pthread_getspecific(_S_inline_depth_key));
+        if (_Delta != 0)
+        {
+            _Depth += _Delta;
+            pthread_setspecific(_S_inline_depth_key, reinterpret_cast<void*>(_Depth));
+        }
+        return static_cast<long>(_Depth);
+    }
+#endif
+
+#if defined(_WIN32)
+    // The Windows heap already has a low fragmentation front end for small blocks.
+    _PPLXIMP void * _pplx_cdecl _AllocatePooled(size_t _Size)
+    {
+        return ::operator new(_Size);
+    }
+
+    _PPLXIMP void _pplx_cdecl _FreePooled(void * _Ptr, size_t)
+    {
+        ::operator delete(_Ptr);
+    }
+#else
+    // Blocks of up to 1024 bytes are rounded up to a power of two and kept on a free list per size class and thread.
+    // A block freed on another thread joins the list of that thread, so producer and consumer threads exchange blocks
+    // without locking. Larger blocks, and blocks beyond the cap of a list, go to the global heap.
+    static const size_t _S_pool_min_size = 32;
+    static const size_t _S_pool_classes = 6;
+    static const size_t _S_pool_max_blocks = 256;
+
+    struct _Pool_block
+    {
+        _Pool_block * _M_next;
+    };
+
+    struct _Pool_cache
+    {
+        _Pool_block * _M_free[_S_pool_classes];
+        size_t _M_count[_S_pool_classes];
+    };
+
+    static pthread_key_t _S_pool_key;
+    static pthread_once_t _S_pool_once = PTHREAD_ONCE_INIT;
+
+    static void _Free_pool_cache(void * _Ptr)
+    {
+        auto _Cache = static_cast<_Pool_cache *>(_Ptr);
+        for (size_t _Class = 0; _Class < _S_pool_classes; ++_Class)
+        {
+            while (_Cache->_M_free[_Class] != nullptr)
+            {
+                auto _Block = _Cache->_M_free[_Class];
+                _Cache->_M_free[_Class] = _Block->_M_next;
+                ::operator delete(_Block);
+            }
+        }
+        delete _Cache;
+    }
+
+    static void _Create_pool_key()
+    {
+        pthread_key_create(&_S_pool_key, _Free_pool_cache);
+    }
+
+    static size_t _Pool_class(size_t _Size)
+    {
+        size_t _Class = 0;
+        while ((_S_pool_min_size << _Class) < _Size)
+        {
+            ++_Class;
+        }
+        return _Class;
+    }
+
+    // A cache created while the thread exits is released by the next round of key destructors.
+    static _Pool_cache * _Get_pool_cache()
+    {
+        pthread_once(&_S_pool_once, _Create_pool_key);
+        auto _Cache = static_cast<_Pool_cache *>(pthread_getspecific(_S_pool_key));
+        if (_Cache == nullptr)
+        {
+            _Cache = new _Pool_cache();
+            pthread_setspecific(_S_pool_key, _Cache);
+        }
+        return _Cache;
+    }
+
+    _PPLXIMP void * _pplx_cdecl _AllocatePooled(size_t _Size)
+    {
+        const auto _Class = _Pool_class(_Size);
+        if (_Class >= _S_pool_classes)
+        {
+            return ::operator new(_Size);
+        }
+
+        auto _Cache = _Get_pool_cache();
+        auto _Block = _Cache->_M_free[_Class];
+        if (_Block == nullptr)
+        {
+            return ::operator new(_S_pool_min_size << _Class);
+        }
+        _Cache->_M_free[_Class] = _Block->_M_next;
+        --_Cache->_M_count[_Class];
+        return _Block;
+    }
+
+    _PPLXIMP void _pplx_cdecl _FreePooled(void * _Ptr, size_t _Size)
+    {
+        const auto _Class = _Pool_class(_Size);
+        if (_Class >= _S_pool_classes)
+        {
+            ::operator delete(_Ptr);
+            return;
+        }
+
+        auto _Cache = _Get_pool_cache();
+        if (_Cache->_M_count[_Class] >= _S_pool_max_blocks)
+        {
+            ::operator delete(_Ptr);
+            return;
+        }
+
+        auto _Block = static_cast<_Pool_block *>(_Ptr);
+        _Block->_M_next = _Cache->_M_free[_Class];
+        _Cache->_M_free[_Class] = _Block;
+        ++_Cache->_M_count[_Class];
+    }
+#endif
+
+#if defined(CPPREST_PPLX_METRICS)
+    // Each thread counts into a block which only it writes, so recording needs no atomic read-modify-write. Readers add
+    // up the blocks under the registry lock, and the block of an exiting thread is folded into the totals of the
+    // threads which exited.
+    struct _Metrics_block
+    {
+        std::atomic<uint64_t> _M_counters[_Metric_counter_count];
+        std::atomic<uint64_t> _M_buckets[_Metric_histogram_count][latency_histogram::bucket_count];
+        std::atomic<uint64_t> _M_totals[_Metric_histogram_count];
+    };
+
+    struct _Metrics_registry
+    {
+        std::mutex _M_lock;
+        std::vector<_Metrics_block *> _M_blocks;
+        scheduler_metrics _M_exited;
+    };
+
+    static uint64_t scheduler_metrics::* const _S_metric_counters[_Metric_counter_count] =
+    {
+        &scheduler_metrics::tasks_created,
+        &scheduler_metrics::continuations_scheduled,
+        &scheduler_metrics::functions_inlined,
+        &scheduler_metrics::functions_queued,
+        &scheduler_metrics::functions_dequeued,
+    };
+
+    static latency_histogram scheduler_metrics::* const _S_metric_histograms[_Metric_histogram_count] =
+    {
+        &scheduler_metrics::queue_latency,
+        &scheduler_metrics::execution_time,
+    };
+
+    // Never destroyed, since threads may exit after the static destructors ran.
+    static _Metrics_registry & _Get_metrics_registry()
+    {
+        static _Metrics_registry * _Registry = new _Metrics_registry();
+        return *_Registry;
+    }
+
+    static void _Add_metrics(scheduler_metrics & _Metrics, const _Metrics_block & _Block)
+    {
+        for (size_t _Counter = 0; _Counter < _Metric_counter_count; ++_Counter)
+        {
+            _Metrics.*_S_metric_counters[_Counter] += _Block._M_counters[_Counter].load(std::memory_order_relaxed);
+        }
+        for (size_t _Histogram = 0; _Histogram < _Metric_histogram_count; ++_Histogram)
+        {
+            auto & _Target = _Metrics.*_S_metric_histograms[_Histogram];
+            for (size_t _Index = 0; _Index < latency_histogram::bucket_count; ++_Index)
+            {
+                const auto _Count = _Block._M_buckets[_Histogram][_Index].load(std::memory_order_relaxed);
+                if (_Count != 0)
+                {
+                    _Target.add(_Index, _Count);
+                }
+            }
+            _Target.add_total(_Block._M_totals[_Histogram].load(std::memory_order_relaxed));
+        }
+    }
+
+    static pthread_key_t _S_metrics_key;
+    static pthread_once_t _S_metrics_once = PTHREAD_ONCE_INIT;
+
+    static void _Retire_metrics_block(void * _Ptr)
+    {
+        auto _Block = static_cast<_Metrics_block *>(_Ptr);
+        auto & _Registry = _Get_metrics_registry();
+        {
+            std::lock_guard<std::mutex> _Lock(_Registry._M_lock);
+            _Add_metrics(_Registry._M_exited, *_Block);
+            _Registry._M_blocks.erase(std::find(_Registry._M_blocks.begin(), _Registry._M_blocks.end(), _Block));
+        }
+        delete _Block;
+    }
+
+    static void _Create_metrics_key()
+    {
+        pthread_key_create(&_S_metrics_key, _Retire_metrics_block);
+    }
+
+    static _Metrics_block * _Get_metrics_block()
+    {
+        pthread_once(&_S_metrics_once, _Create_metrics_key);
+        auto _Block = static_cast<_Metrics_block *>(pthread_getspecific(_S_metrics_key));
+        if (_Block == nullptr)
+        {
+            _Block = new _Metrics_block();
+            auto & _Registry = _Get_metrics_registry();
+            {
+                std::lock_guard<std::mutex> _Lock(_Registry._M_lock);
+                _Registry._M_blocks.push_back(_Block);
+            }
+            pthread_setspecific(_S_metrics_key, _Block);
+        }
+        return _Block;
+    }
+
+    static void _Increment(std::atomic<uint64_t> & _Value, uint64_t _Delta)
+    {
+        _Value.store(_Value.load(std::memory_order_relaxed) + _Delta, std::memory_order_relaxed);
+    }
+
+    _PPLXIMP void _pplx_cdecl _RecordMetric(_Metric_counter _Counter)
+    {
+        _Increment(_Get_metrics_block()->_M_counters[_Counter], 1);
+    }
+
+    _PPLXIMP void _pplx_cdecl _RecordMetric(_Metric_histogram _Histogram, std::chrono::steady_clock::duration _Duration)
+    {
+        const auto _Nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(_Duration).count();
+        const uint64_t _Value = _Nanoseconds > 0 ? static_cast<uint64_t>(_Nanoseconds) : 0;
+        auto _Block = _Get_metrics_block();
+        _Increment(_Block->_M_buckets[_Histogram][latency_histogram::bucket_index(_Value)], 1);
+        _Increment(_Block->_M_totals[_Histogram], _Value);
+    }
+#endif
 } // namespace details
 
+#if defined(CPPREST_PPLX_METRICS)
+_PPLXIMP scheduler_metrics _pplx_cdecl get_scheduler_metrics()
+{
+    auto & _Registry = details::_Get_metrics_registry();
+    std::lock_guard<std::mutex> _Lock(_Registry._M_lock);
+    scheduler_metrics _Metrics = _Registry._M_exited;
+    for (auto _Block : _Registry._M_blocks)
+    {
+        details::_Add_metrics(_Metrics, *_Block);
+    }
+    return _Metrics;
+}
+#endif
+
 static struct _pplx_g_sched_t
 {
     typedef std::shared_ptr<pplx::scheduler_interface> sched_ptr;
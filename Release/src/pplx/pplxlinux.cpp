@@ -15,6 +15,12 @@
 #include "pplx/pplx.h"
 #include "pplx/threadpool.h"
 #include "sys/syscall.h"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
 
 #ifdef _WIN32
 #error "ERROR: This file should only be included in non-windows Build"
@@ -38,9 +44,433 @@ namespace details {
         }
     }
 
+    namespace
+    {
+#if defined(CPPREST_PPLX_METRICS)
+        // Wraps a scheduled function to record how long it waited in the queue.
+        struct timed_proc : _PooledObject
+        {
+            TaskProc_t m_proc;
+            void* m_param;
+            std::chrono::steady_clock::time_point m_queued;
+
+            static void wrap(TaskProc_t &proc, void* &param)
+            {
+                auto timed = new timed_proc();
+                timed->m_proc = proc;
+                timed->m_param = param;
+                timed->m_queued = std::chrono::steady_clock::now();
+                _RecordMetric(_Metric_functions_queued);
+
+                proc = run;
+                param = timed;
+            }
+
+            static void run(void* param)
+            {
+                std::unique_ptr<timed_proc> timed(static_cast<timed_proc*>(param));
+                _RecordMetric(_Metric_functions_dequeued);
+                _RecordMetric(_Metric_queue_latency, std::chrono::steady_clock::now() - timed->m_queued);
+                timed->m_proc(timed->m_param);
+            }
+        };
+#endif
+    }
+
     _PPLXIMP void linux_scheduler::schedule(TaskProc_t proc, void* param)
     {
-        crossplat::threadpool::shared_instance().service().post(boost::bind(proc, param));
+#if defined(CPPREST_PPLX_METRICS)
+        timed_proc::wrap(proc, param);
+#endif
+        crossplat::threadpool::compute_instance().run(proc, param);
+    }
+
+    namespace
+    {
+        // A fixed capacity Chase-Lev deque. Only the owning worker pushes and pops at the back,
+        // any thread may steal from the front.
+        class work_stealing_deque
+        {
+        public:
+            static const int64_t capacity = 1024;
+
+            work_stealing_deque() : m_top(0), m_bottom(0)
+            {
+            }
+
+            // Called by the owner only, fails if the deque is full.
+            bool push(TaskProc_t proc, void* param)
+            {
+                const auto bottom = m_bottom.load(std::memory_order_relaxed);
+                const auto top = m_top.load(std::memory_order_acquire);
+                if (bottom - top >= capacity)
+                {
+                    return false;
+                }
+
+                auto &slot = m_slots[bottom & (capacity - 1)];
+                slot.m_proc.store(proc, std::memory_order_relaxed);
+                slot.m_param.store(param, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return true;
+            }
+
+            // Called by the owner only, takes the most recently pushed task.
+            bool pop(TaskProc_t &proc, void* &param)
+            {
+                const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+                m_bottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                auto top = m_top.load(std::memory_order_relaxed);
+
+                bool result = false;
+                if (top <= bottom)
+                {
+                    auto &slot = m_slots[bottom & (capacity - 1)];
+                    proc = slot.m_proc.load(std::memory_order_relaxed);
+                    param = slot.m_param.load(std::memory_order_relaxed);
+                    result = true;
+                    if (top == bottom)
+                    {
+                        // Last task, race the thieves for it.
+                        result = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                    }
+                }
+                else
+                {
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+                return result;
+            }
+
+            // Called by any thread, takes the least recently pushed task. May fail spuriously under contention.
+            bool steal(TaskProc_t &proc, void* &param)
+            {
+                auto top = m_top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const auto bottom = m_bottom.load(std::memory_order_acquire);
+                if (top >= bottom)
+                {
+                    return false;
+                }
+
+                // The slot cannot be reused before top moves past it, so the values read are valid if the exchange succeeds.
+                auto &slot = m_slots[top & (capacity - 1)];
+                proc = slot.m_proc.load(std::memory_order_relaxed);
+                param = slot.m_param.load(std::memory_order_relaxed);
+                return m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            }
+
+            bool empty() const
+            {
+                return m_top.load(std::memory_order_seq_cst) >= m_bottom.load(std::memory_order_seq_cst);
+            }
+
+        private:
+            struct slot
+            {
+                std::atomic<TaskProc_t> m_proc;
+                std::atomic<void*> m_param;
+            };
+
+            std::atomic<int64_t> m_top;
+            std::atomic<int64_t> m_bottom;
+            slot m_slots[capacity];
+        };
+
+        pthread_key_t current_worker_key()
+        {
+            static pthread_key_t s_key;
+            static pthread_once_t s_once = PTHREAD_ONCE_INIT;
+            pthread_once(&s_once, [] { pthread_key_create(&s_key, nullptr); });
+            return s_key;
+        }
+    }
+
+    class _work_stealing_impl
+    {
+    public:
+        explicit _work_stealing_impl(const crossplat::threadpool_options &options)
+            : m_options(options)
+            , m_workers(options.min_threads == 0 ? hardware_threads() : options.min_threads)
+            , m_global_count(0)
+            , m_sleeping(0)
+            , m_stop(false)
+            , m_stopped(false)
+        {
+            for (size_t i = 0; i < m_workers.size(); ++i)
+            {
+                m_workers[i].m_index = i;
+            }
+        }
+
+        // Each worker keeps the implementation alive until it has exited.
+        static void start(const std::shared_ptr<_work_stealing_impl> &impl)
+        {
+            for (auto &worker : impl->m_workers)
+            {
+                worker.m_owner = impl.get();
+                worker.m_thread = std::thread(&_work_stealing_impl::thread_start, impl, &worker);
+            }
+        }
+
+        // Lets the workers finish the remaining tasks and waits for them to exit. Tasks which were scheduled while the
+        // workers were exiting are run here, as are tasks scheduled from then on.
+        void shutdown()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_sleep_lock);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+
+            for (auto &worker : m_workers)
+            {
+                // The scheduler may be released by a task running on one of its own workers.
+                if (worker.m_thread.get_id() == std::this_thread::get_id())
+                {
+                    worker.m_thread.detach();
+                }
+                else if (worker.m_thread.joinable())
+                {
+                    worker.m_thread.join();
+                }
+            }
+
+            m_stopped.store(true);
+            TaskProc_t proc;
+            void* param;
+            while (pop_global(proc, param) || steal_any(proc, param))
+            {
+                proc(param);
+            }
+        }
+
+        void schedule(TaskProc_t proc, void* param)
+        {
+            if (m_stopped.load())
+            {
+                proc(param);
+                return;
+            }
+
+            auto current = static_cast<worker*>(pthread_getspecific(current_worker_key()));
+            if (current == nullptr || current->m_owner != this || !current->m_tasks.push(proc, param))
+            {
+                std::lock_guard<std::mutex> lock(m_global_lock);
+                m_global.push_back(std::make_pair(proc, param));
+                m_global_count.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // Pairs with the check made by a worker before it goes to sleep.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_sleeping.load(std::memory_order_relaxed) != 0)
+            {
+                std::lock_guard<std::mutex> lock(m_sleep_lock);
+                m_wake.notify_one();
+            }
+        }
+
+    private:
+        struct worker
+        {
+            worker() : m_owner(nullptr), m_index(0) {}
+
+            _work_stealing_impl* m_owner;
+            size_t m_index;
+            std::thread m_thread;
+            work_stealing_deque m_tasks;
+        };
+
+        bool pop_global(TaskProc_t &proc, void* &param)
+        {
+            if (m_global_count.load(std::memory_order_relaxed) == 0)
+            {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(m_global_lock);
+            if (m_global.empty())
+            {
+                return false;
+            }
+            proc = m_global.front().first;
+            param = m_global.front().second;
+            m_global.pop_front();
+            m_global_count.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        bool steal(worker &thief, TaskProc_t &proc, void* &param)
+        {
+            const auto count = m_workers.size();
+            for (size_t i = 1; i < count; ++i)
+            {
+                if (m_workers[(thief.m_index + i) % count].m_tasks.steal(proc, param))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool steal_any(TaskProc_t &proc, void* &param)
+        {
+            for (auto &worker : m_workers)
+            {
+                if (worker.m_tasks.steal(proc, param))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool find_task(worker &self, TaskProc_t &proc, void* &param)
+        {
+            return self.m_tasks.pop(proc, param) || pop_global(proc, param) || steal(self, proc, param);
+        }
+
+        bool has_work() const
+        {
+            if (m_global_count.load(std::memory_order_seq_cst) != 0)
+            {
+                return true;
+            }
+            for (const auto &worker : m_workers)
+            {
+                if (!worker.m_tasks.empty())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static size_t hardware_threads()
+        {
+            const size_t count = std::thread::hardware_concurrency();
+            return count == 0 ? 1 : count;
+        }
+
+        void setup_thread(const worker &self)
+        {
+#if defined(__linux__) && !defined(__ANDROID__)
+            if (m_options.cpu_affinity)
+            {
+                cpu_set_t cpus;
+                CPU_ZERO(&cpus);
+                CPU_SET(self.m_index % hardware_threads(), &cpus);
+                pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+            }
+#endif
+            if (!m_options.thread_name.empty())
+            {
+                auto name = m_options.thread_name + std::to_string(self.m_index);
+                name.resize(std::min<size_t>(name.size(), 15));
+                pthread_setname_np(pthread_self(), name.c_str());
+            }
+        }
+
+        static void thread_start(std::shared_ptr<_work_stealing_impl> impl, worker* self)
+        {
+            impl->setup_thread(*self);
+            impl->run(self);
+        }
+
+        void run(worker* self)
+        {
+            pthread_setspecific(current_worker_key(), self);
+
+            TaskProc_t proc;
+            void* param;
+            for (;;)
+            {
+                if (find_task(*self, proc, param))
+                {
+                    proc(param);
+                    continue;
+                }
+
+                // Spin briefly before going to sleep, a new task often arrives right away.
+                bool found = false;
+                for (int i = 0; i < 16 && !found; ++i)
+                {
+                    std::this_thread::yield();
+                    found = find_task(*self, proc, param);
+                }
+                if (found)
+                {
+                    proc(param);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(m_sleep_lock);
+                m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+                if (!has_work())
+                {
+                    if (m_stop)
+                    {
+                        m_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+                        break;
+                    }
+                    m_wake.wait(lock);
+                }
+                m_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+            }
+
+            pthread_setspecific(current_worker_key(), nullptr);
+        }
+
+        const crossplat::threadpool_options m_options;
+        std::vector<worker> m_workers;
+
+        std::mutex m_global_lock;
+        std::deque<std::pair<TaskProc_t, void*>> m_global;
+        std::atomic<size_t> m_global_count;
+
+        std::mutex m_sleep_lock;
+        std::condition_variable m_wake;
+        std::atomic<size_t> m_sleeping;
+        bool m_stop;
+        std::atomic<bool> m_stopped;
+    };
+
+    namespace
+    {
+        crossplat::threadpool_options worker_options(size_t num_threads)
+        {
+            crossplat::threadpool_options options;
+            options.min_threads = num_threads;
+            return options;
+        }
+    }
+
+    _PPLXIMP work_stealing_scheduler::work_stealing_scheduler(size_t num_threads)
+        : m_impl(std::make_shared<_work_stealing_impl>(worker_options(num_threads)))
+    {
+        _work_stealing_impl::start(m_impl);
+    }
+
+    _PPLXIMP work_stealing_scheduler::work_stealing_scheduler(const crossplat::threadpool_options &options)
+        : m_impl(std::make_shared<_work_stealing_impl>(options))
+    {
+        _work_stealing_impl::start(m_impl);
+    }
+
+    _PPLXIMP work_stealing_scheduler::~work_stealing_scheduler()
+    {
+        m_impl->shutdown();
+    }
+
+    _PPLXIMP void work_stealing_scheduler::schedule(TaskProc_t proc, void* param)
+    {
+#if defined(CPPREST_PPLX_METRICS)
+        timed_proc::wrap(proc, param);
+#endif
+        m_impl->schedule(proc, param);
     }
 
 } // namespace details
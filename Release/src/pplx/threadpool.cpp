@@ -18,6 +18,12 @@
 #include <thread>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
 #if defined(__ANDROID__)
@@ -28,20 +34,71 @@
 namespace
 {
 
+size_t hardware_threads()
+{
+    const size_t count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+crossplat::threadpool_options normalize(crossplat::threadpool_options options)
+{
+    if (options.min_threads == 0)
+    {
+        options.min_threads = hardware_threads();
+    }
+    if (options.max_threads < options.min_threads)
+    {
+        options.max_threads = options.min_threads;
+    }
+    return options;
+}
+
 struct threadpool_impl final : crossplat::threadpool
 {
-    threadpool_impl(size_t n)
-        : crossplat::threadpool(n)
+    threadpool_impl(const crossplat::threadpool_options &options)
+        // The concurrency hint must cover every thread the pool may grow to. With a hint of one, asio keeps
+        // work posted from a pool thread on that thread, where threads added later cannot see it.
+        : crossplat::threadpool(normalize(options).max_threads)
+        , m_options(normalize(options))
+        , m_stopping(false)
+        , m_threads_count(0)
         , m_work(m_service)
+        , m_probe_pending(false)
+        , m_running(0)
+        , m_peak_running(0)
+        , m_started(0)
+        , m_next_index(0)
     {
-        for (size_t i = 0; i < n; i++)
-            add_thread();
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            for (size_t i = 0; i < m_options.min_threads; i++)
+                add_thread();
+        }
+        if (m_options.max_threads > m_options.min_threads)
+            m_monitor = std::thread(&threadpool_impl::monitor, this);
     }
 
     ~threadpool_impl()
     {
+        if (m_monitor.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+                m_stopping = true;
+            }
+            m_monitor_wake.notify_one();
+            m_monitor.join();
+        }
+
         m_service.stop();
-        for (auto iter = m_threads.begin(); iter != m_threads.end(); ++iter)
+
+        decltype(m_threads) threads;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_stopping = true;
+            threads.swap(m_threads);
+        }
+        for (auto iter = threads.begin(); iter != threads.end(); ++iter)
         {
 #if defined(CPPREST_PTHREADS)
             pthread_t t = *iter;
@@ -53,7 +110,46 @@ struct threadpool_impl final : crossplat::threadpool
         }
     }
 
+    void run(void (*proc)(void*), void* param) override
+    {
+        if (m_options.max_threads == m_options.min_threads)
+        {
+            m_service.post(boost::bind(proc, param));
+            return;
+        }
+
+        m_service.post([this, proc, param]()
+        {
+            ++m_started;
+            running_guard guard(*this);
+            proc(param);
+        });
+    }
+
+    size_t size() const override
+    {
+        return m_threads_count.load();
+    }
+
 private:
+    struct running_guard
+    {
+        running_guard(threadpool_impl &pool) : m_pool(pool)
+        {
+            auto running = ++m_pool.m_running;
+            auto peak = m_pool.m_peak_running.load();
+            while (running > peak && !m_pool.m_peak_running.compare_exchange_weak(peak, running)) {}
+        }
+
+        ~running_guard()
+        {
+            --m_pool.m_running;
+        }
+
+        threadpool_impl &m_pool;
+    };
+
+    // Called with m_lock held.
     void add_thread()
     {
 #ifdef CPPREST_PTHREADS
@@ -64,6 +160,111 @@ private:
 #else
         m_threads.push_back(std::thread(&thread_start, this));
 #endif
+        m_threads_count.store(m_threads.size());
+    }
+
+    void grow()
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (!m_stopping && m_threads.size() < m_options.max_threads)
+            add_thread();
+    }
+
+    // Runs on its own thread for pools which can change size, since the threads of the pool may all be blocked.
+    void monitor()
+    {
+        const auto tick = std::chrono::milliseconds(50);
+        auto idle_since = std::chrono::steady_clock::now();
+        size_t last_started = 0;
+
+        std::unique_lock<std::mutex> lock(m_lock);
+        while (!m_stopping)
+        {
+            m_monitor_wake.wait_for(lock, tick);
+            if (m_stopping)
+                break;
+            lock.unlock();
+
+            // The probe goes through the same queue as every other handler, so one still pending after a whole tick
+            // means queued work has waited that long. The pool only grows if no function passed to run started in
+            // that tick either, so a burst of short functions is left to the threads already running.
+            const auto started = m_started.load();
+            if (!m_probe_pending.exchange(true))
+                m_service.post([this]() { m_probe_pending.store(false); });
+            else if (started == last_started)
+                grow();
+            last_started = started;
+
+            // Retire one thread per idle timeout while some threads went unused for the whole period.
+            const auto now = std::chrono::steady_clock::now();
+            if (m_peak_running.load() >= m_threads_count.load())
+            {
+                idle_since = now;
+                m_peak_running.store(m_running.load());
+            }
+            else if (now - idle_since >= m_options.idle_timeout)
+            {
+                if (m_threads_count.load() > m_options.min_threads)
+                    m_service.post([]() { throw retire_signal(); });
+                idle_since = now;
+                m_peak_running.store(m_running.load());
+            }
+
+            lock.lock();
+        }
+    }
+
+    struct retire_signal {};
+
+    // Called on a thread which leaves the pool while the pool keeps running.
+    void retire_thread()
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (m_stopping)
+            return;
+        for (auto iter = m_threads.begin(); iter != m_threads.end(); ++iter)
+        {
+#if defined(CPPREST_PTHREADS)
+            if (pthread_equal(*iter, pthread_self()))
+            {
+                pthread_detach(*iter);
+                m_threads.erase(iter);
+                break;
+            }
+#else
+            if (iter->get_id() == std::this_thread::get_id())
+            {
+                iter->detach();
+                m_threads.erase(iter);
+                break;
+            }
+#endif
+        }
+        m_threads_count.store(m_threads.size());
+    }
+
+    void setup_thread()
+    {
+        const auto index = m_next_index++;
+#if defined(__linux__) && !defined(__ANDROID__)
+        if (m_options.cpu_affinity)
+        {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(index % hardware_threads(), &cpus);
+            pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+        }
+#endif
+        if (!m_options.thread_name.empty())
+        {
+            auto name = m_options.thread_name + std::to_string(index);
+#if defined(__linux__)
+            name.resize(std::min<size_t>(name.size(), 15));
+            pthread_setname_np(pthread_self(), name.c_str());
+#elif defined(__APPLE__)
+            pthread_setname_np(name.c_str());
+#endif
+        }
     }
 
 #if defined(__ANDROID__)
@@ -81,22 +282,128 @@ private:
         pthread_cleanup_push(detach_from_java, nullptr);
 #endif
         threadpool_impl* _this = reinterpret_cast<threadpool_impl*>(arg);
-        _this->m_service.run();
+        _this->setup_thread();
+        try
+        {
+            _this->m_service.run();
+        }
+        catch (const retire_signal&)
+        {
+            _this->retire_thread();
+        }
 #if defined(__ANDROID__)
         pthread_cleanup_pop(true);
 #endif
         return arg;
     }
 
+    const crossplat::threadpool_options m_options;
+    std::mutex m_lock;
+    bool m_stopping;
 #if defined(CPPREST_PTHREADS)
     std::vector<pthread_t> m_threads;
 #else
     std::vector<std::thread> m_threads;
 #endif
+    std::atomic<size_t> m_threads_count;
     boost::asio::io_service::work m_work;
+    std::atomic<bool> m_probe_pending;
+    std::atomic<size_t> m_running;
+    std::atomic<size_t> m_peak_running;
+    std::atomic<size_t> m_started;
+    std::atomic<size_t> m_next_index;
+    std::thread m_monitor;
+    std::condition_variable m_monitor_wake;
 };
 }
 
+namespace
+{
+
+crossplat::threadpool_options default_options(const char *thread_name)
+{
+    // The shared pool keeps the 40 threads it always had, since callers may block all of them in continuations.
+    // More threads are only added while queued work is stalled.
+    crossplat::threadpool_options options;
+    options.min_threads = std::max<size_t>(hardware_threads(), 40);
+    options.max_threads = 2 * options.min_threads;
+    options.thread_name = thread_name;
+    return options;
+}
+
+class shared_pools
+{
+public:
+    shared_pools() : m_io(nullptr), m_compute(nullptr)
+    {
+    }
+
+    crossplat::threadpool& io()
+    {
+        auto pool = m_io.load(std::memory_order_acquire);
+        if (pool == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            if (!m_io_owner)
+            {
+                m_io_owner.reset(new threadpool_impl(default_options("cpprest-")));
+                m_io.store(m_io_owner.get(), std::memory_order_release);
+            }
+            pool = m_io_owner.get();
+        }
+        return *pool;
+    }
+
+    crossplat::threadpool& compute()
+    {
+        auto pool = m_compute.load(std::memory_order_acquire);
+        if (pool == nullptr)
+        {
+            // Without a separate compute pool, tasks run on the shared pool.
+            auto &io_pool = io();
+            std::lock_guard<std::mutex> lock(m_lock);
+            if (m_compute.load() == nullptr)
+            {
+                m_compute.store(&io_pool, std::memory_order_release);
+            }
+            pool = m_compute.load();
+        }
+        return *pool;
+    }
+
+    void initialize(const crossplat::threadpool_options &io_options, const crossplat::threadpool_options *compute_options)
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (m_io.load() != nullptr || m_compute.load() != nullptr)
+        {
+            throw std::runtime_error("The shared thread pool is already in use");
+        }
+
+        m_io_owner.reset(new threadpool_impl(io_options));
+        if (compute_options != nullptr)
+        {
+            m_compute_owner.reset(new threadpool_impl(*compute_options));
+            m_compute.store(m_compute_owner.get(), std::memory_order_release);
+        }
+        m_io.store(m_io_owner.get(), std::memory_order_release);
+    }
+
+private:
+    std::mutex m_lock;
+    std::atomic<crossplat::threadpool*> m_io;
+    std::atomic<crossplat::threadpool*> m_compute;
+    std::unique_ptr<threadpool_impl> m_io_owner;
+    std::unique_ptr<threadpool_impl> m_compute_owner;
+};
+
+shared_pools& pools()
+{
+    static shared_pools s_pools;
+    return s_pools;
+}
+
+}
+
 namespace crossplat
 {
 #if defined(__ANDROID__)
@@ -128,8 +435,13 @@ JNIEnv* get_jvm_env()
 threadpool& threadpool::shared_instance()
 {
     abort_if_no_jvm();
-    static threadpool_impl s_shared(40);
-    return s_shared;
+    return pools().io();
+}
+
+threadpool& threadpool::compute_instance()
+{
+    abort_if_no_jvm();
+    return pools().compute();
 }
 
 #else
@@ -137,12 +449,34 @@ threadpool& threadpool::shared_instance()
 // initialize the static shared threadpool
 threadpool& threadpool::shared_instance()
 {
-    static threadpool_impl s_shared(40);
-    return s_shared;
+    return pools().io();
+}
+
+threadpool& threadpool::compute_instance()
+{
+    return pools().compute();
 }
 
 #endif
 
+void threadpool::initialize_with_threads(size_t num_threads)
+{
+    threadpool_options options;
+    options.min_threads = num_threads;
+    options.thread_name = "cpprest-";
+    pools().initialize(options, nullptr);
+}
+
+void threadpool::initialize(const threadpool_options &options)
+{
+    pools().initialize(options, nullptr);
+}
+
+void threadpool::initialize(const threadpool_options &io_options, const threadpool_options &compute_options)
+{
+    pools().initialize(io_options, &compute_options);
+}
+
 }
 
 #if defined(__ANDROID__)
@@ -153,5 +487,12 @@ void cpprest_init(JavaVM* vm) {
 
 std::unique_ptr<crossplat::threadpool> crossplat::threadpool::construct(size_t num_threads)
 {
-    return std::unique_ptr<crossplat::threadpool>(new threadpool_impl(num_threads));
+    crossplat::threadpool_options options;
+    options.min_threads = num_threads;
+    return std::unique_ptr<crossplat::threadpool>(new threadpool_impl(options));
+}
+
+std::unique_ptr<crossplat::threadpool> crossplat::threadpool::construct(const threadpool_options &options)
+{
+    return std::unique_ptr<crossplat::threadpool>(new threadpool_impl(options));
 }
@@ -0,0 +1,232 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* binding_tests.cpp
+*
+* Tests for the pull based JSON reader and binding JSON to C++ types.
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+
+#include "stdafx.h"
+#include "cpprest/json_binding.h"
+
+using namespace web; using namespace utility;
+
+namespace tests { namespace functional { namespace json_tests {
+
+SUITE(binding_tests)
+{
+
+struct address
+{
+    address() : number(0) {}
+
+    utility::string_t street;
+    int number;
+
+    template <typename Binder>
+    void json_fields(Binder &binder)
+    {
+        binder.field(U("street"), street);
+        binder.field(U("number"), number);
+    }
+};
+
+struct person
+{
+    person() : age(0), id(0), score(0), active(false) {}
+
+    utility::string_t name;
+    int age;
+    uint64_t id;
+    double score;
+    bool active;
+    std::vector<utility::string_t> tags;
+    std::vector<address> addresses;
+    std::vector<std::vector<int>> matrix;
+    json::value extra;
+
+    template <typename Binder>
+    void json_fields(Binder &binder)
+    {
+        binder.field(U("name"), name);
+        binder.field(U("age"), age);
+        binder.field(U("id"), id);
+        binder.field(U("score"), score);
+        binder.field(U("active"), active);
+        binder.field(U("tags"), tags);
+        binder.field(U("addresses"), addresses);
+        binder.field(U("matrix"), matrix);
+        binder.field(U("extra"), extra);
+    }
+};
+
+const utility::char_t *sample_text()
+{
+    return U("{\"name\":\"Jane \\\"J\\\" Doe\",\"age\":42,\"id\":18446744073709551615,\"score\":-1.5,\"active\":true,")
+        U("\"tags\":[\"a\",\"b\"],\"addresses\":[{\"street\":\"Main\",\"number\":1},{\"street\":\"Side\",\"number\":-2}],")
+        U("\"matrix\":[[1,2],[],[3]],\"extra\":{\"x\":[null,{\"y\":false}]}}");
+}
+
+void verify_sample(const person &p)
+{
+    VERIFY_ARE_EQUAL(U("Jane \"J\" Doe"), p.name);
+    VERIFY_ARE_EQUAL(42, p.age);
+    VERIFY_ARE_EQUAL(18446744073709551615ULL, p.id);
+    VERIFY_ARE_EQUAL(-1.5, p.score);
+    VERIFY_IS_TRUE(p.active);
+    VERIFY_ARE_EQUAL(2u, p.tags.size());
+    VERIFY_ARE_EQUAL(U("b"), p.tags[1]);
+    VERIFY_ARE_EQUAL(2u, p.addresses.size());
+    VERIFY_ARE_EQUAL(U("Side"), p.addresses[1].street);
+    VERIFY_ARE_EQUAL(-2, p.addresses[1].number);
+    VERIFY_ARE_EQUAL(3u, p.matrix.size());
+    VERIFY_ARE_EQUAL(2, p.matrix[0][1]);
+    VERIFY_IS_TRUE(p.matrix[1].empty());
+    VERIFY_IS_FALSE(p.extra.at(U("x")).at(1).at(U("y")).as_bool());
+}
+
+TEST(reader_tokens)
+{
+    const utility::string_t text = U("{\"a\":[1,-2,2.5,\"s\",true,null],\"b\":{}}");
+    json::json_reader reader(text);
+
+    const json::json_reader::token_kind expected[] = {
+        json::json_reader::begin_object,
+        json::json_reader::property_name,
+        json::json_reader::begin_array,
+        json::json_reader::integer_value,
+        json::json_reader::integer_value,
+        json::json_reader::number_value,
+        json::json_reader::string_value,
+        json::json_reader::boolean_value,
+        json::json_reader::null_value,
+        json::json_reader::end_array,
+        json::json_reader::property_name,
+        json::json_reader::begin_object,
+        json::json_reader::end_object,
+        json::json_reader::end_object,
+        json::json_reader::end_of_input,
+        json::json_reader::end_of_input
+    };
+    for (auto kind : expected)
+    {
+        VERIFY_ARE_EQUAL(kind, reader.read());
+        if (kind == json::json_reader::integer_value && reader.is_signed())
+        {
+            VERIFY_ARE_EQUAL(-2, reader.as_int64());
+        }
+    }
+}
+
+TEST(reader_skip)
+{
+    const utility::string_t text = U("[{\"a\":[[1],{\"b\":2}]},3]");
+    json::json_reader reader(text);
+    reader.read();
+    VERIFY_ARE_EQUAL(json::json_reader::begin_object, reader.read());
+    reader.skip();
+    VERIFY_ARE_EQUAL(json::json_reader::end_object, reader.kind());
+    VERIFY_ARE_EQUAL(json::json_reader::integer_value, reader.read());
+    VERIFY_ARE_EQUAL(3u, reader.as_uint64());
+}
+
+TEST(reader_malformed)
+{
+    const utility::char_t *texts[] = {
+        U(""), U("{"), U("{\"a\"}"), U("{\"a\":1,}"), U("[1,]"), U("[1 2]"), U("{\"a\":1]"), U("[1}"), U("1 2"), U("{1:2}")
+    };
+    for (auto text : texts)
+    {
+        const utility::string_t str(text);
+        json::json_reader reader(str);
+        VERIFY_THROWS(
+            while (reader.read() != json::json_reader::end_of_input) {},
+            json::json_exception);
+    }
+}
+
+TEST(from_and_to_value)
+{
+    person p;
+    json::from_json(json::value::parse(sample_text()), p);
+    verify_sample(p);
+
+    auto val = json::to_json(p);
+    VERIFY_ARE_EQUAL(U("name"), val.as_object().begin()->first);
+
+    person copy;
+    json::from_json(val, copy);
+    verify_sample(copy);
+}
+
+TEST(parse_and_serialize_direct)
+{
+    person p;
+    json::parse_json(sample_text(), p);
+    verify_sample(p);
+
+    // Direct serialization matches the value produced through the DOM.
+    const auto text = json::serialize_json(p);
+    VERIFY_ARE_EQUAL(utility::conversions::to_utf8string(json::to_json(p).serialize()), text);
+
+    person copy;
+    json::parse_json(utility::conversions::to_string_t(text), copy);
+    verify_sample(copy);
+}
+
+TEST(missing_and_unknown_fields)
+{
+    address a;
+    a.street = U("unchanged");
+    json::parse_json(U("{\"number\":7,\"other\":{\"street\":[1,{\"number\":2}]},\"more\":\"x\"}"), a);
+    VERIFY_ARE_EQUAL(U("unchanged"), a.street);
+    VERIFY_ARE_EQUAL(7, a.number);
+
+    address b;
+    json::from_json(json::value::parse(U("{\"number\":8,\"other\":1}")), b);
+    VERIFY_IS_TRUE(b.street.empty());
+    VERIFY_ARE_EQUAL(8, b.number);
+}
+
+TEST(type_mismatch)
+{
+    address a;
+    VERIFY_THROWS(json::parse_json(U("{\"number\":\"7\"}"), a), json::json_exception);
+    VERIFY_THROWS(json::parse_json(U("{\"number\":1.5}"), a), json::json_exception);
+    VERIFY_THROWS(json::parse_json(U("{\"number\":3000000000}"), a), json::json_exception);
+    VERIFY_THROWS(json::parse_json(U("[]"), a), json::json_exception);
+    VERIFY_THROWS(json::parse_json(U("{\"number\":1} x"), a), json::json_exception);
+    VERIFY_THROWS(json::from_json(json::value::parse(U("{\"number\":-1e3}")), a), json::json_exception);
+    VERIFY_THROWS(json::from_json(json::value::parse(U("{\"street\":1}")), a), json::json_exception);
+
+    std::vector<unsigned char> bytes;
+    VERIFY_THROWS(json::parse_json(U("[1,256]"), bytes), json::json_exception);
+    VERIFY_THROWS(json::from_json(json::value::parse(U("[-1]")), bytes), json::json_exception);
+}
+
+TEST(large_array_direct)
+{
+    std::vector<address> addresses(10000);
+    for (size_t i = 0; i < addresses.size(); ++i)
+    {
+        addresses[i].street = U("street");
+        addresses[i].number = static_cast<int>(i);
+    }
+
+    const auto text = utility::conversions::to_string_t(json::serialize_json(addresses));
+    std::vector<address> parsed;
+    json::parse_json(text, parsed);
+
+    VERIFY_ARE_EQUAL(addresses.size(), parsed.size());
+    VERIFY_ARE_EQUAL(9999, parsed.back().number);
+    VERIFY_ARE_EQUAL(text, json::to_json(parsed).serialize());
+}
+
+} // SUITE(binding_tests)
+
+}}}
@@ -275,6 +275,104 @@ TEST(object_construction_from_null_keep_order)
     VERIFY_ARE_EQUAL(val2.as_object().begin()->first, U("A"));
 }
 
+TEST(object_keep_order_large)
+{
+    // Sizes on both sides of the point where ordered objects start using a hash index.
+    const size_t sizes[] = { 1, 31, 32, 33, 100, 5000 };
+    for (auto size : sizes)
+    {
+        auto val = json::value::object(/*keep_order==*/ true);
+        for (size_t i = size; i > 0; --i)
+        {
+            val[utility::conversions::print_string(i)] = json::value(static_cast<uint64_t>(i));
+        }
+        VERIFY_ARE_EQUAL(size, val.size());
+
+        const auto &obj = val.as_object();
+        VERIFY_ARE_EQUAL(utility::conversions::print_string(size), obj.begin()->first);
+        for (size_t i = 1; i <= size; ++i)
+        {
+            auto key = utility::conversions::print_string(i);
+            VERIFY_IS_TRUE(val.has_field(key));
+            VERIFY_ARE_EQUAL(i, obj.at(key).as_number().to_uint64());
+        }
+        VERIFY_IS_TRUE(obj.find(U("missing")) == obj.end());
+
+        // Erasing shifts later fields, lookups must still find them.
+        val.as_object().erase(utility::conversions::print_string(size));
+        VERIFY_ARE_EQUAL(size - 1, val.size());
+        VERIFY_IS_FALSE(val.has_field(utility::conversions::print_string(size)));
+        for (size_t i = 1; i < size; ++i)
+        {
+            VERIFY_ARE_EQUAL(i, val.at(utility::conversions::print_string(i)).as_number().to_uint64());
+        }
+
+        // Copies are independent of the original.
+        json::value copy = val;
+        copy[U("extra")] = json::value(true);
+        VERIFY_IS_TRUE(copy.has_field(U("extra")));
+        VERIFY_IS_FALSE(val.has_field(U("extra")));
+        VERIFY_ARE_EQUAL(U("extra"), copy.as_object().rbegin()->first);
+    }
+}
+
+TEST(object_keep_order_erase_large)
+{
+    auto val = json::value::object(/*keep_order==*/ true);
+    for (int i = 0; i < 100; ++i)
+    {
+        val[utility::conversions::print_string(i)] = json::value(i);
+    }
+
+    // The first lookup builds the index, the erases below then update it in place.
+    VERIFY_ARE_EQUAL(50, val.at(U("50")).as_integer());
+    auto &obj = val.as_object();
+    for (int i = 0; i < 100; i += 3)
+    {
+        obj.erase(utility::conversions::print_string(i));
+    }
+    obj.erase(obj.begin() + 10);
+    obj[U("new")] = json::value(-1);
+
+    int expected = 0;
+    for (auto iter = obj.begin(); iter != obj.end(); ++iter)
+    {
+        VERIFY_ARE_EQUAL(iter->second.as_integer(), obj.at(iter->first).as_integer());
+        ++expected;
+    }
+    VERIFY_ARE_EQUAL(expected, static_cast<int>(obj.size()));
+    VERIFY_IS_TRUE(obj.find(U("0")) == obj.end());
+    VERIFY_ARE_EQUAL(-1, obj.at(U("new")).as_integer());
+}
+
+TEST(object_parse_keep_order_large)
+{
+    struct restore {
+        ~restore() {
+            json::keep_object_element_order(false);
+        }
+    }_;
+
+    json::keep_object_element_order(true);
+
+    utility::stringstream_t ss;
+    ss << U("{");
+    for (int i = 999; i >= 0; --i)
+    {
+        ss << U("\"k") << i << U("\":") << i << (i == 0 ? U("") : U(","));
+    }
+    ss << U("}");
+
+    auto val = json::value::parse(ss.str());
+    VERIFY_ARE_EQUAL(1000u, val.size());
+    VERIFY_ARE_EQUAL(U("k999"), val.as_object().begin()->first);
+    for (int i = 0; i < 1000; ++i)
+    {
+        VERIFY_ARE_EQUAL(i, val.at(U("k") + utility::conversions::print_string(i)).as_integer());
+    }
+    VERIFY_ARE_EQUAL(ss.str(), val.serialize());
+}
+
 TEST(array_construction)
 {
     // Constructor which takes a vector.
@@ -0,0 +1,149 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* ndjson_tests.cpp
+*
+* Tests for reading newline delimited JSON streams.
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+
+#include "stdafx.h"
+#include "cpprest/json_ndjson.h"
+#include "cpprest/containerstream.h"
+#include "cpprest/producerconsumerstream.h"
+
+using namespace web; using namespace utility;
+using namespace concurrency::streams;
+
+namespace tests { namespace functional { namespace json_tests {
+
+SUITE(ndjson_tests)
+{
+
+std::string make_records(int count)
+{
+    std::string text;
+    for (int i = 0; i < count; ++i)
+    {
+        text += "{\"id\":" + std::to_string(i) + ",\"name\":\"record " + std::to_string(i) + "\"}\n";
+    }
+    return text;
+}
+
+std::vector<json::value> read_all(json::ndjson_reader &reader)
+{
+    std::vector<json::value> records;
+    reader.for_each([&records](json::ndjson_batch &batch)
+    {
+        for (auto &record : batch.records)
+        {
+            records.push_back(std::move(record));
+        }
+    }).wait();
+    return records;
+}
+
+TEST(ordered_batches)
+{
+    const int count = 10000;
+    const size_t batch_sizes[] = { 1, 100, 4096, json::ndjson_reader::default_batch_size };
+    for (auto batch_size : batch_sizes)
+    {
+        json::ndjson_reader reader(bytestream::open_istream(make_records(count)), true, batch_size, 4);
+        auto records = read_all(reader);
+
+        VERIFY_ARE_EQUAL(static_cast<size_t>(count), records.size());
+        for (int i = 0; i < count; ++i)
+        {
+            VERIFY_ARE_EQUAL(i, records[i].at(U("id")).as_integer());
+        }
+    }
+}
+
+TEST(ordered_sequence)
+{
+    json::ndjson_reader reader(bytestream::open_istream(make_records(1000)), true, 512);
+    size_t expected = 0;
+    while (reader.move_next().get())
+    {
+        VERIFY_ARE_EQUAL(expected++, reader.current().sequence);
+        VERIFY_IS_FALSE(reader.current().records.empty());
+    }
+    VERIFY_IS_TRUE(expected > 1);
+    VERIFY_IS_FALSE(reader.move_next().get());
+}
+
+TEST(unordered_batches)
+{
+    const int count = 10000;
+    json::ndjson_reader reader(bytestream::open_istream(make_records(count)), false, 1024, 8);
+    auto records = read_all(reader);
+
+    VERIFY_ARE_EQUAL(static_cast<size_t>(count), records.size());
+    std::vector<bool> seen(count, false);
+    for (const auto &record : records)
+    {
+        const int id = record.at(U("id")).as_integer();
+        VERIFY_IS_FALSE(seen[id]);
+        seen[id] = true;
+    }
+}
+
+TEST(blank_lines_and_line_endings)
+{
+    const std::string text = "\n{\"a\":1}\r\n   \r\n[1,2]\n\n\"last\"";
+    json::ndjson_reader reader(bytestream::open_istream(text), true, 4);
+    auto records = read_all(reader);
+
+    VERIFY_ARE_EQUAL(3u, records.size());
+    VERIFY_ARE_EQUAL(1, records[0].at(U("a")).as_integer());
+    VERIFY_ARE_EQUAL(2u, records[1].size());
+    VERIFY_ARE_EQUAL(U("last"), records[2].as_string());
+}
+
+TEST(empty_input)
+{
+    json::ndjson_reader reader(bytestream::open_istream(std::string()));
+    VERIFY_IS_FALSE(reader.move_next().get());
+}
+
+TEST(malformed_record)
+{
+    json::ndjson_reader reader(bytestream::open_istream(std::string("{\"a\":1}\n{\"a\":\n")), true, 1);
+    VERIFY_IS_TRUE(reader.move_next().get());
+    VERIFY_THROWS(reader.move_next().get(), json::json_exception);
+}
+
+TEST(producer_consumer_input)
+{
+    producer_consumer_buffer<uint8_t> buffer;
+    json::ndjson_reader reader(buffer.create_istream(), true, 256, 2);
+
+    const int count = 2000;
+    auto writer = pplx::create_task([buffer, count]()
+    {
+        auto target = buffer;
+        // Write in pieces which do not line up with record boundaries.
+        const auto text = make_records(count);
+        for (size_t pos = 0; pos < text.size(); pos += 37)
+        {
+            const auto size = std::min(static_cast<size_t>(37), text.size() - pos);
+            target.putn_nocopy(reinterpret_cast<const uint8_t *>(&text[pos]), size).wait();
+        }
+        target.close(std::ios_base::out).wait();
+    });
+
+    auto records = read_all(reader);
+    writer.wait();
+
+    VERIFY_ARE_EQUAL(static_cast<size_t>(count), records.size());
+    VERIFY_ARE_EQUAL(count - 1, records.back().at(U("id")).as_integer());
+}
+
+} // SUITE(ndjson_tests)
+
+}}}
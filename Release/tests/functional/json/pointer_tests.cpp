@@ -0,0 +1,156 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* pointer_tests.cpp
+*
+* Tests for JSON Pointer and JSONPath queries.
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+
+#include "stdafx.h"
+#include "cpprest/json_pointer.h"
+
+using namespace web; using namespace utility;
+
+namespace tests { namespace functional { namespace json_tests {
+
+SUITE(pointer_tests)
+{
+
+// The example document from RFC 6901.
+json::value rfc_document()
+{
+    return json::value::parse(U("{\"foo\":[\"bar\",\"baz\"],\"\":0,\"a/b\":1,\"c%d\":2,\"e^f\":3,\"g|h\":4,\"i\\\\j\":5,")
+        U("\"k\\\"l\":6,\" \":7,\"m~n\":8}"));
+}
+
+json::value store_document()
+{
+    return json::value::parse(U("{\"store\":{\"book\":[")
+        U("{\"author\":\"Nigel Rees\",\"price\":8.95},")
+        U("{\"author\":\"Evelyn Waugh\",\"price\":12.99},")
+        U("{\"author\":\"Herman Melville\",\"price\":8.99,\"isbn\":\"0-553-21311-3\"},")
+        U("{\"author\":\"J. R. R. Tolkien\",\"price\":22.99,\"isbn\":\"0-395-19395-8\"}],")
+        U("\"bicycle\":{\"color\":\"red\",\"price\":19.95}}}"));
+}
+
+TEST(pointer_rfc_examples)
+{
+    const auto doc = rfc_document();
+
+    VERIFY_ARE_EQUAL(&doc, json::json_pointer(U("")).find(doc));
+    VERIFY_ARE_EQUAL(doc.at(U("foo")), json::json_pointer(U("/foo")).at(doc));
+    VERIFY_ARE_EQUAL(U("bar"), json::json_pointer(U("/foo/0")).at(doc).as_string());
+    VERIFY_ARE_EQUAL(0, json::json_pointer(U("/")).at(doc).as_integer());
+    VERIFY_ARE_EQUAL(1, json::json_pointer(U("/a~1b")).at(doc).as_integer());
+    VERIFY_ARE_EQUAL(2, json::json_pointer(U("/c%d")).at(doc).as_integer());
+    VERIFY_ARE_EQUAL(3, json::json_pointer(U("/e^f")).at(doc).as_integer());
+    VERIFY_ARE_EQUAL(4, json::json_pointer(U("/g|h")).at(doc).as_integer());
+    VERIFY_ARE_EQUAL(5, json::json_pointer(U("/i\\j")).at(doc).as_integer());
+    VERIFY_ARE_EQUAL(6, json::json_pointer(U("/k\"l")).at(doc).as_integer());
+    VERIFY_ARE_EQUAL(7, json::json_pointer(U("/ ")).at(doc).as_integer());
+    VERIFY_ARE_EQUAL(8, json::json_pointer(U("/m~0n")).at(doc).as_integer());
+}
+
+TEST(pointer_misses)
+{
+    const auto doc = rfc_document();
+
+    VERIFY_IS_TRUE(json::json_pointer(U("/missing")).find(doc) == nullptr);
+    VERIFY_IS_TRUE(json::json_pointer(U("/foo/2")).find(doc) == nullptr);
+    VERIFY_IS_TRUE(json::json_pointer(U("/foo/-")).find(doc) == nullptr);
+    VERIFY_IS_TRUE(json::json_pointer(U("/foo/01")).find(doc) == nullptr);
+    VERIFY_IS_TRUE(json::json_pointer(U("/foo/0/x")).find(doc) == nullptr);
+    VERIFY_THROWS(json::json_pointer(U("/missing")).at(doc), json::json_exception);
+}
+
+TEST(pointer_syntax)
+{
+    VERIFY_THROWS(json::json_pointer(U("foo")), json::json_exception);
+    VERIFY_THROWS(json::json_pointer(U("/foo~")), json::json_exception);
+    VERIFY_THROWS(json::json_pointer(U("/foo~2")), json::json_exception);
+
+    json::json_pointer pointer(U("/a~1b/m~0n/0/"));
+    VERIFY_ARE_EQUAL(4u, pointer.tokens().size());
+    VERIFY_ARE_EQUAL(U("a/b"), pointer.tokens()[0]);
+    VERIFY_ARE_EQUAL(U("m~n"), pointer.tokens()[1]);
+    VERIFY_ARE_EQUAL(U(""), pointer.tokens()[3]);
+    VERIFY_ARE_EQUAL(U("/a~1b/m~0n/0/"), pointer.to_string());
+}
+
+TEST(pointer_modify_in_place)
+{
+    auto doc = json::value::parse(U("{\"a\":{\"b\":[1,2,3]}}"));
+    json::json_pointer pointer(U("/a/b/1"));
+    *pointer.find(doc) = json::value::string(U("two"));
+    VERIFY_ARE_EQUAL(U("two"), doc.at(U("a")).at(U("b")).at(1).as_string());
+}
+
+TEST(path_members_and_indices)
+{
+    const auto doc = store_document();
+
+    VERIFY_ARE_EQUAL(&doc, json::json_path(U("$")).find(doc));
+    VERIFY_ARE_EQUAL(U("red"), json::json_path(U("$.store.bicycle.color")).find(doc)->as_string());
+    VERIFY_ARE_EQUAL(U("red"), json::json_path(U("$['store'][\"bicycle\"]['color']")).find(doc)->as_string());
+    VERIFY_ARE_EQUAL(U("Evelyn Waugh"), json::json_path(U("$.store.book[1].author")).find(doc)->as_string());
+    VERIFY_ARE_EQUAL(U("J. R. R. Tolkien"), json::json_path(U("$.store.book[-1].author")).find(doc)->as_string());
+    VERIFY_IS_TRUE(json::json_path(U("$.store.book[4]")).find(doc) == nullptr);
+    VERIFY_IS_TRUE(json::json_path(U("$.store.missing.color")).find(doc) == nullptr);
+}
+
+TEST(path_wildcards_and_slices)
+{
+    const auto doc = store_document();
+
+    auto authors = json::json_path(U("$.store.book[*].author")).evaluate(doc);
+    VERIFY_ARE_EQUAL(4u, authors.size());
+    VERIFY_ARE_EQUAL(U("Nigel Rees"), authors[0]->as_string());
+    VERIFY_ARE_EQUAL(U("J. R. R. Tolkien"), authors[3]->as_string());
+
+    VERIFY_ARE_EQUAL(2u, json::json_path(U("$.store.*")).evaluate(doc).size());
+    VERIFY_ARE_EQUAL(2u, json::json_path(U("$.store.book[:2]")).evaluate(doc).size());
+    VERIFY_ARE_EQUAL(2u, json::json_path(U("$.store.book[-2:]")).evaluate(doc).size());
+    VERIFY_ARE_EQUAL(1u, json::json_path(U("$.store.book[1:2]")).evaluate(doc).size());
+    VERIFY_ARE_EQUAL(0u, json::json_path(U("$.store.book[3:1]")).evaluate(doc).size());
+}
+
+TEST(path_recursive_descent)
+{
+    const auto doc = store_document();
+
+    auto prices = json::json_path(U("$..price")).evaluate(doc);
+    VERIFY_ARE_EQUAL(5u, prices.size());
+
+    auto isbns = json::json_path(U("$.store..isbn")).evaluate(doc);
+    VERIFY_ARE_EQUAL(2u, isbns.size());
+    VERIFY_ARE_EQUAL(U("0-553-21311-3"), isbns[0]->as_string());
+
+    auto third = json::json_path(U("$..book[2].author")).evaluate(doc);
+    VERIFY_ARE_EQUAL(1u, third.size());
+    VERIFY_ARE_EQUAL(U("Herman Melville"), third[0]->as_string());
+
+    auto firsts = json::json_path(U("$..[0]")).evaluate(doc);
+    VERIFY_ARE_EQUAL(1u, firsts.size());
+    VERIFY_ARE_EQUAL(U("Nigel Rees"), firsts[0]->at(U("author")).as_string());
+}
+
+TEST(path_syntax)
+{
+    VERIFY_THROWS(json::json_path(U("")), json::json_exception);
+    VERIFY_THROWS(json::json_path(U("store")), json::json_exception);
+    VERIFY_THROWS(json::json_path(U("$.")), json::json_exception);
+    VERIFY_THROWS(json::json_path(U("$[")), json::json_exception);
+    VERIFY_THROWS(json::json_path(U("$['a'")), json::json_exception);
+    VERIFY_THROWS(json::json_path(U("$[a]")), json::json_exception);
+    VERIFY_THROWS(json::json_path(U("$[?(@.a)]")), json::json_exception);
+    VERIFY_THROWS(json::json_path(U("$x")), json::json_exception);
+}
+
+} // SUITE(pointer_tests)
+
+}}}
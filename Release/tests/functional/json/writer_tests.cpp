@@ -0,0 +1,141 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* writer_tests.cpp
+*
+* Tests for the streaming JSON writer.
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+
+#include "stdafx.h"
+#include "cpprest/json_writer.h"
+#include "cpprest/containerstream.h"
+#include "cpprest/producerconsumerstream.h"
+
+using namespace web; using namespace utility;
+using namespace concurrency::streams;
+
+namespace tests { namespace functional { namespace json_tests {
+
+SUITE(writer_tests)
+{
+
+json::value sample_value()
+{
+    return json::value::parse(U("{\"name\":\"a \\\"quoted\\\" \\n string\",\"int\":-42,\"uint\":18446744073709551615,")
+        U("\"double\":1.5,\"bool\":true,\"null\":null,\"empty\":{},\"list\":[1,[2,3],{\"x\":[]},\"\\u0001\"]}"));
+}
+
+TEST(write_value_ostream)
+{
+    const auto val = sample_value();
+    std::ostringstream stream;
+    json::json_writer writer(stream);
+    writer.write(val);
+    writer.flush().wait();
+    VERIFY_ARE_EQUAL(utility::conversions::to_utf8string(val.serialize()), stream.str());
+}
+
+TEST(write_value_small_chunks)
+{
+    const auto val = sample_value();
+    const auto expected = utility::conversions::to_utf8string(val.serialize());
+
+    const size_t chunk_sizes[] = { 0, 1, 7, 4096 };
+    for (auto chunk_size : chunk_sizes)
+    {
+        container_buffer<std::vector<uint8_t>> buffer;
+        json::json_writer writer(buffer, chunk_size);
+        writer.write(val);
+        writer.flush().wait();
+        VERIFY_ARE_EQUAL(expected, std::string(buffer.collection().begin(), buffer.collection().end()));
+    }
+}
+
+TEST(push_api)
+{
+    std::ostringstream stream;
+    json::json_writer writer(stream);
+    writer.begin_object();
+    writer.key(U("a"));
+    writer.number(1);
+    writer.key(U("b\t"));
+    writer.begin_array();
+    writer.null();
+    writer.boolean(false);
+    writer.number(static_cast<uint64_t>(7));
+    writer.number(-2.5);
+    writer.string(U("s\""));
+    writer.write(json::value::parse(U("{\"c\":[true]}")));
+    writer.begin_object();
+    writer.end_object();
+    writer.end_array();
+    writer.end_object();
+    writer.flush().wait();
+
+    VERIFY_ARE_EQUAL("{\"a\":1,\"b\\t\":[null,false,7,-2.5,\"s\\\"\",{\"c\":[true]},{}]}", stream.str());
+    VERIFY_ARE_EQUAL(U("true"), json::value::parse(utility::conversions::to_string_t(stream.str())).at(U("b\t")).at(5).at(U("c")).at(0).serialize());
+}
+
+TEST(push_api_misuse)
+{
+    std::ostringstream stream;
+    json::json_writer writer(stream);
+    VERIFY_THROWS(writer.key(U("a")), json::json_exception);
+    VERIFY_THROWS(writer.end_array(), json::json_exception);
+
+    writer.begin_object();
+    VERIFY_THROWS(writer.number(1), json::json_exception);
+    VERIFY_THROWS(writer.end_array(), json::json_exception);
+    writer.key(U("a"));
+    VERIFY_THROWS(writer.key(U("b")), json::json_exception);
+    VERIFY_THROWS(writer.end_object(), json::json_exception);
+    writer.number(1);
+    writer.end_object();
+
+    // Only one top level value is allowed.
+    VERIFY_THROWS(writer.null(), json::json_exception);
+    VERIFY_THROWS(writer.begin_array(), json::json_exception);
+}
+
+TEST(stream_large_array_to_consumer)
+{
+    producer_consumer_buffer<uint8_t> buffer;
+    auto reader = buffer.create_istream();
+
+    const int count = 100000;
+    auto result = pplx::create_task([buffer, count]()
+    {
+        json::json_writer writer(buffer, 1024);
+        writer.begin_array();
+        for (int i = 0; i < count; ++i)
+        {
+            writer.begin_object();
+            writer.key(U("id"));
+            writer.number(i);
+            writer.end_object();
+        }
+        writer.end_array();
+        return writer.flush().then([buffer]() mutable
+        {
+            return buffer.close(std::ios_base::out);
+        });
+    });
+
+    container_buffer<std::string> collected;
+    reader.read_to_end(collected).wait();
+    result.wait();
+
+    auto parsed = json::value::parse(utility::conversions::to_string_t(collected.collection()));
+
+    VERIFY_ARE_EQUAL(static_cast<size_t>(count), parsed.size());
+    VERIFY_ARE_EQUAL(count - 1, parsed.at(count - 1).at(U("id")).as_integer());
+}
+
+} // SUITE(writer_tests)
+
+}}}
@@ -0,0 +1,361 @@
+/***
+* Copyright (C) Microsoft. All rights reserved.
+* Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+*
+* =+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+=+
+*
+* Tests for the PPLX schedulers.
+*
+* =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+****/
+
+#include "stdafx.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+
+namespace tests { namespace functional { namespace PPLX {
+
+SUITE(pplx_scheduler_tests)
+{
+
+TEST(work_stealing_then_chain)
+{
+    auto sched = std::make_shared<pplx::details::work_stealing_scheduler>(4);
+
+    auto t = pplx::create_task([]() { return 0; }, sched);
+    for (int i = 0; i < 10000; ++i)
+    {
+        t = t.then([](int n) { return n + 1; });
+    }
+    VERIFY_ARE_EQUAL(10000, t.get());
+}
+
+TEST(work_stealing_fan_out)
+{
+    auto sched = std::make_shared<pplx::details::work_stealing_scheduler>(8);
+    std::atomic<int> count(0);
+
+    // Each task schedules children from a worker thread, which go to the local deque and get stolen.
+    std::vector<pplx::task<void>> tasks;
+    for (int i = 0; i < 50; ++i)
+    {
+        tasks.push_back(pplx::create_task([&count, sched]()
+        {
+            std::vector<pplx::task<void>> children;
+            for (int j = 0; j < 2000; ++j)
+            {
+                children.push_back(pplx::create_task([&count]() { ++count; }, sched));
+            }
+            return pplx::when_all(children.begin(), children.end());
+        }, sched));
+    }
+    pplx::when_all(tasks.begin(), tasks.end()).wait();
+
+    VERIFY_ARE_EQUAL(50 * 2000, count.load());
+}
+
+TEST(work_stealing_blocking_tasks)
+{
+    // Tasks may block on other tasks as long as there are enough workers.
+    auto sched = std::make_shared<pplx::details::work_stealing_scheduler>(2);
+    pplx::task_completion_event<void> tce;
+
+    auto waiter = pplx::create_task([tce]() { pplx::create_task(tce).wait(); }, sched);
+    auto setter = pplx::create_task([tce]() { tce.set(); }, sched);
+
+    setter.wait();
+    waiter.wait();
+}
+
+TEST(work_stealing_shutdown)
+{
+    std::atomic<int> count(0);
+    {
+        pplx::details::work_stealing_scheduler sched(3);
+        for (int i = 0; i < 1000; ++i)
+        {
+            sched.schedule([](void *param) { ++*static_cast<std::atomic<int> *>(param); }, &count);
+        }
+    }
+
+    // Pending tasks are run before the workers exit.
+    VERIFY_ARE_EQUAL(1000, count.load());
+}
+
+namespace
+{
+struct nested_tasks
+{
+    pplx::details::work_stealing_scheduler *sched;
+    std::atomic<int> count;
+};
+
+void run_nested(void *param)
+{
+    auto ctx = static_cast<nested_tasks *>(param);
+    if (++ctx->count % 2 == 1)
+    {
+        ctx->sched->schedule(run_nested, ctx);
+    }
+}
+}
+
+TEST(work_stealing_shutdown_nested)
+{
+    nested_tasks ctx;
+    ctx.count = 0;
+    {
+        pplx::details::work_stealing_scheduler sched(2);
+        ctx.sched = &sched;
+        for (int i = 0; i < 500; ++i)
+        {
+            sched.schedule(run_nested, &ctx);
+        }
+    }
+
+    // Tasks scheduled by tasks while the workers exit still run.
+    VERIFY_ARE_EQUAL(1000, ctx.count.load());
+}
+
+TEST(work_stealing_options)
+{
+    crossplat::threadpool_options options;
+    options.min_threads = 1;
+    options.thread_name = "ws-test-";
+    auto sched = std::make_shared<pplx::details::work_stealing_scheduler>(options);
+
+    auto name = pplx::create_task([]()
+    {
+        char name[16] = {};
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        return std::string(name);
+    }, sched).get();
+
+    VERIFY_ARE_EQUAL("ws-test-0", name);
+}
+
+TEST(work_stealing_released_on_worker)
+{
+    pplx::extensibility::event_t done;
+    {
+        auto sched = std::make_shared<pplx::details::work_stealing_scheduler>(2);
+        pplx::create_task([sched]() {}, sched).then([&done]() { done.set(); });
+    }
+
+    // The task holding the last reference releases the scheduler on one of its own workers.
+    done.wait();
+}
+
+TEST(threadpool_fixed_size)
+{
+    crossplat::threadpool_options options;
+    options.min_threads = 3;
+    auto pool = crossplat::threadpool::construct(options);
+    VERIFY_ARE_EQUAL(3u, pool->size());
+
+    pplx::extensibility::event_t done;
+    pool->run([](void *param) { static_cast<pplx::extensibility::event_t *>(param)->set(); }, &done);
+    done.wait();
+    VERIFY_ARE_EQUAL(3u, pool->size());
+}
+
+TEST(threadpool_grows_and_shrinks)
+{
+    crossplat::threadpool_options options;
+    options.min_threads = 1;
+    options.max_threads = 4;
+    options.idle_timeout = std::chrono::milliseconds(100);
+    auto pool = crossplat::threadpool::construct(options);
+    VERIFY_ARE_EQUAL(1u, pool->size());
+
+    // Each function blocks until all of them run at the same time, which needs the pool to grow.
+    struct barrier
+    {
+        std::mutex m_lock;
+        std::condition_variable m_cv;
+        int m_count;
+        size_t m_size;
+        crossplat::threadpool *m_pool;
+    } state;
+    state.m_count = 0;
+    state.m_pool = pool.get();
+
+    pplx::details::atomic_long finished(0);
+    std::pair<barrier *, pplx::details::atomic_long *> param(&state, &finished);
+    for (int i = 0; i < 4; ++i)
+    {
+        pool->run([](void *p)
+        {
+            auto args = static_cast<std::pair<barrier *, pplx::details::atomic_long *> *>(p);
+            std::unique_lock<std::mutex> lock(args->first->m_lock);
+            if (++args->first->m_count == 4)
+            {
+                args->first->m_size = args->first->m_pool->size();
+                args->first->m_cv.notify_all();
+            }
+            args->first->m_cv.wait(lock, [args] { return args->first->m_count == 4; });
+            pplx::details::atomic_increment(*args->second);
+        }, &param);
+    }
+
+    while (finished != 4)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    VERIFY_ARE_EQUAL(4u, state.m_size);
+
+    for (int i = 0; i < 500 && pool->size() > 1; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    VERIFY_ARE_EQUAL(1u, pool->size());
+}
+
+TEST(threadpool_grows_for_blocked_handlers)
+{
+    crossplat::threadpool_options options;
+    options.min_threads = 1;
+    options.max_threads = 2;
+    auto pool = crossplat::threadpool::construct(options);
+
+    // The first handler blocks the only thread until the second one runs, which needs the pool to grow even though
+    // neither handler went through run.
+    pplx::extensibility::event_t unblock, done;
+    pool->service().post([&]() { unblock.wait(); done.set(); });
+    pool->service().post([&]() { unblock.set(); });
+    done.wait();
+
+    VERIFY_ARE_EQUAL(2u, pool->size());
+}
+
+TEST(threadpool_short_functions_do_not_grow)
+{
+    crossplat::threadpool_options options;
+    options.min_threads = 1;
+    options.max_threads = 4;
+    auto pool = crossplat::threadpool::construct(options);
+
+    pplx::details::atomic_long finished(0);
+    for (int i = 0; i < 100; ++i)
+    {
+        pool->run([](void *p)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            pplx::details::atomic_increment(*static_cast<pplx::details::atomic_long *>(p));
+        }, &finished);
+    }
+    while (finished != 100)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // Functions kept starting on the one thread, so the queue never stalled.
+    VERIFY_ARE_EQUAL(1u, pool->size());
+}
+
+TEST(threadpool_thread_names)
+{
+    crossplat::threadpool_options options;
+    options.min_threads = 1;
+    options.thread_name = "tp-test-";
+    auto pool = crossplat::threadpool::construct(options);
+
+    std::pair<pplx::extensibility::event_t, std::string> result;
+    pool->run([](void *param)
+    {
+        auto r = static_cast<std::pair<pplx::extensibility::event_t, std::string> *>(param);
+        char name[16] = {};
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        r->second = name;
+        r->first.set();
+    }, &result);
+    result.first.wait();
+
+    VERIFY_ARE_EQUAL("tp-test-0", result.second);
+}
+
+TEST(threadpool_initialize_after_use)
+{
+    crossplat::threadpool::shared_instance();
+    VERIFY_THROWS(crossplat::threadpool::initialize_with_threads(4), std::runtime_error);
+}
+
+#if defined(CPPREST_PPLX_METRICS)
+TEST(latency_histogram_buckets)
+{
+    VERIFY_ARE_EQUAL(7u, pplx::latency_histogram::bucket_index(7));
+    VERIFY_ARE_EQUAL(8u, pplx::latency_histogram::bucket_index(8));
+    VERIFY_ARE_EQUAL(pplx::latency_histogram::bucket_count - 1, pplx::latency_histogram::bucket_index(UINT64_MAX));
+    VERIFY_ARE_EQUAL(UINT64_MAX, pplx::latency_histogram::bucket_upper_bound(pplx::latency_histogram::bucket_count - 1));
+
+    // Every duration falls in a bucket whose upper bound is at most 12.5% above it, and buckets are contiguous.
+    for (uint64_t value = 1; value < (uint64_t(1) << 40); value = value * 3 / 2 + 1)
+    {
+        const auto index = pplx::latency_histogram::bucket_index(value);
+        const auto bound = pplx::latency_histogram::bucket_upper_bound(index);
+        VERIFY_IS_TRUE(bound >= value);
+        VERIFY_IS_TRUE(bound - value <= value / 8);
+        VERIFY_ARE_EQUAL(index + 1, pplx::latency_histogram::bucket_index(bound + 1));
+    }
+
+    pplx::latency_histogram histogram;
+    VERIFY_ARE_EQUAL(0, histogram.percentile(0.5).count());
+    for (uint64_t value = 1; value <= 100; ++value)
+    {
+        histogram.record(value * 1000);
+    }
+    VERIFY_ARE_EQUAL(100u, histogram.count());
+    VERIFY_ARE_EQUAL(5050000, histogram.total().count());
+    VERIFY_IS_TRUE(histogram.percentile(0.5).count() >= 50000 && histogram.percentile(0.5).count() < 57000);
+    VERIFY_IS_TRUE(histogram.percentile(1.0).count() >= 100000 && histogram.percentile(1.0).count() < 113000);
+}
+
+TEST(scheduler_metrics_tasks)
+{
+    const auto before = pplx::get_scheduler_metrics();
+
+    pplx::create_task([]() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); })
+        .then([]() {})
+        .wait();
+
+    // The execution time of a task is recorded after its continuations were scheduled, so it may trail the wait.
+    auto after = pplx::get_scheduler_metrics();
+    for (int i = 0; i < 500 && after.execution_time.count() < before.execution_time.count() + 2; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        after = pplx::get_scheduler_metrics();
+    }
+    VERIFY_IS_TRUE(after.tasks_created >= before.tasks_created + 1);
+    VERIFY_IS_TRUE(after.continuations_scheduled >= before.continuations_scheduled + 1);
+    VERIFY_IS_TRUE(after.functions_queued >= before.functions_queued + 1);
+    VERIFY_IS_TRUE(after.queue_latency.count() >= before.queue_latency.count() + 1);
+    VERIFY_IS_TRUE(after.execution_time.count() >= before.execution_time.count() + 2);
+    VERIFY_IS_TRUE(after.execution_time.percentile(1.0) >= std::chrono::milliseconds(20));
+}
+
+TEST(scheduler_metrics_exited_threads)
+{
+    const auto before = pplx::get_scheduler_metrics();
+
+    // Counts of a thread are kept after it exits.
+    std::thread([]()
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            pplx::details::_RecordMetric(pplx::details::_Metric_functions_inlined);
+        }
+    }).join();
+
+    VERIFY_IS_TRUE(pplx::get_scheduler_metrics().functions_inlined >= before.functions_inlined + 10);
+}
+#endif
+
+} // SUITE(pplx_scheduler_tests)
+
+}}}
+
+#endif
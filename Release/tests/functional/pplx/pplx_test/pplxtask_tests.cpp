@@ -9,6 +9,9 @@
 * =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 ****/
 #include "stdafx.h"
+#include <cstring>
+#include <thread>
+#include "pplx/pplxawait.h"
 
 using namespace ::pplx;
 using namespace ::tests::common::utilities;
@@ -1870,6 +1873,339 @@ TEST(TestInlineChunker)
     VERIFY_IS_TRUE(sum == numiter, "TestInlineChunker: async_for did not return correct result.");
 }
 
+#if !(defined(_MSC_VER) && (_MSC_VER >= 1800)) || CPPREST_FORCE_PPLX
+
+TEST(TestSynchronousContinuationOnCompletedTask)
+{
+    const long caller = pplx::details::platform::GetCurrentThreadId();
+    long continuation = 0;
+    task_from_result(1).then([&continuation](int) { continuation = pplx::details::platform::GetCurrentThreadId(); },
+        task_continuation_context::use_synchronous_execution());
+    VERIFY_ARE_EQUAL(caller, continuation);
+
+    task_completion_event<void> tce;
+    tce.set();
+    continuation = 0;
+    create_task(tce).then([&continuation]() { continuation = pplx::details::platform::GetCurrentThreadId(); },
+        task_continuation_context::use_synchronous_execution());
+    VERIFY_ARE_EQUAL(caller, continuation);
+}
+
+TEST(TestSynchronousContinuationRunsOnCompletingThread)
+{
+    task_completion_event<int> tce;
+    long continuation = 0;
+    auto t = create_task(tce).then([&continuation](int) { continuation = pplx::details::platform::GetCurrentThreadId(); },
+        task_continuation_context::use_synchronous_execution());
+
+    long setter = 0;
+    create_task([tce, &setter]()
+    {
+        setter = pplx::details::platform::GetCurrentThreadId();
+        tce.set(1);
+    }).wait();
+    t.wait();
+    VERIFY_ARE_EQUAL(setter, continuation);
+}
+
+TEST(TestSynchronousContinuationDepthIsBounded)
+{
+    // Each continuation adds the next one from inside the previous one, which would overflow the stack without a bound.
+    std::function<task<int>(int)> chain;
+    chain = [&chain](int n) -> task<int>
+    {
+        if (n == 0)
+        {
+            return task_from_result(0);
+        }
+        return task_from_result(n - 1).then([&chain](int next) { return chain(next); },
+            task_continuation_context::use_synchronous_execution());
+    };
+    VERIFY_ARE_EQUAL(0, chain(100000).get());
+}
+
+TEST(TestDefaultContinuationOnCompletedTaskIsScheduled)
+{
+    // Without the synchronous context, then() never runs the continuation on the calling thread.
+    extensibility::event_t started, release;
+    auto t = task_from_result().then([&started, &release]()
+    {
+        started.set();
+        release.wait();
+    });
+    started.wait();
+    release.set();
+    t.wait();
+}
+
+TEST(TestUnwrappedTaskCompletionIsScheduled)
+{
+    // The outer task completes from a scheduled continuation of the inner one, not on the thread completing the
+    // inner task, even when a synchronous continuation waits on the outer task.
+    task_completion_event<int> tce;
+    extensibility::event_t started;
+    long continuation = 0;
+    auto t = create_task([tce, &started]()
+    {
+        auto inner = create_task(tce);
+        started.set();
+        return inner;
+    }).then([&continuation](int)
+    {
+        continuation = pplx::details::platform::GetCurrentThreadId();
+    }, task_continuation_context::use_synchronous_execution());
+
+    started.wait();
+    tce.set(1);
+    t.wait();
+    VERIFY_ARE_NOT_EQUAL(pplx::details::platform::GetCurrentThreadId(), continuation);
+}
+
+TEST(TestCancellationContinuationsAreScheduled)
+{
+    // A faulted task runs its continuations through cancellation, which schedules them rather than running them on
+    // the thread setting the exception.
+    task_completion_event<void> tce;
+    long continuation = 0;
+    auto t = create_task(tce).then([&continuation](task<void> antecedent)
+    {
+        continuation = pplx::details::platform::GetCurrentThreadId();
+        VERIFY_THROWS(antecedent.get(), std::runtime_error);
+    }, task_continuation_context::use_synchronous_execution());
+
+    tce.set_exception(std::runtime_error("fault"));
+    t.wait();
+    VERIFY_ARE_NOT_EQUAL(pplx::details::platform::GetCurrentThreadId(), continuation);
+}
+
+TEST(TestContinuationsAddedWhileCompleting)
+{
+    // Threads add continuations while the antecedent completes or faults. Each continuation runs exactly once, whether
+    // it was added before or after the antecedent reached its final state.
+    const int threads = 4, per_thread = 500;
+    for (int round = 0; round < 20; ++round)
+    {
+        task_completion_event<int> tce;
+        auto antecedent = create_task(tce);
+        pplx::details::atomic_long ran(0), canceled(0);
+        std::vector<std::thread> adders;
+        std::vector<task<void>> continuations(threads * per_thread);
+        extensibility::event_t go;
+        for (int t = 0; t < threads; ++t)
+        {
+            adders.push_back(std::thread([&, t]()
+            {
+                go.wait();
+                for (int i = 0; i < per_thread; ++i)
+                {
+                    continuations[t * per_thread + i] = antecedent.then([&ran](int) { pplx::details::atomic_increment(ran); });
+                }
+            }));
+        }
+
+        go.set();
+        if (round % 2 == 0)
+        {
+            tce.set(round);
+        }
+        else
+        {
+            tce.set_exception(std::runtime_error("fault"));
+        }
+        for (auto &adder : adders)
+        {
+            adder.join();
+        }
+
+        for (auto &continuation : continuations)
+        {
+            try
+            {
+                continuation.wait();
+            }
+            catch (const std::runtime_error &)
+            {
+                pplx::details::atomic_increment(canceled);
+            }
+        }
+        VERIFY_ARE_EQUAL(round % 2 == 0 ? threads * per_thread : 0, ran);
+        VERIFY_ARE_EQUAL(round % 2 == 0 ? 0 : threads * per_thread, canceled);
+    }
+}
+
+TEST(TestWhenAllManyTasks)
+{
+    // The results keep the order of the tasks, whatever order they complete in.
+    const int count = 10000;
+    std::vector<task_completion_event<int>> events(count);
+    std::vector<task<int>> tasks;
+    for (auto &tce : events)
+    {
+        tasks.push_back(create_task(tce));
+    }
+
+    auto all = when_all(tasks.begin(), tasks.end());
+    for (int i = count - 1; i >= 0; --i)
+    {
+        VERIFY_IS_FALSE(all.is_done());
+        events[i].set(i);
+    }
+
+    auto results = all.get();
+    VERIFY_ARE_EQUAL(static_cast<size_t>(count), results.size());
+    for (int i = 0; i < count; ++i)
+    {
+        VERIFY_ARE_EQUAL(i, results[i]);
+    }
+}
+
+TEST(TestWhenAllManyTasksFault)
+{
+    const int count = 1000;
+    std::vector<task_completion_event<void>> events(count);
+    std::vector<task<void>> tasks;
+    for (auto &tce : events)
+    {
+        tasks.push_back(create_task(tce));
+    }
+
+    auto all = when_all(tasks.begin(), tasks.end());
+    events[count / 2].set_exception(std::runtime_error("fault"));
+
+    // The join faults as soon as one task does, without waiting for the others.
+    VERIFY_THROWS(all.get(), std::runtime_error);
+    for (auto &tce : events)
+    {
+        tce.set();
+    }
+}
+
+TEST(TestWhenAnyManyTasks)
+{
+    const int count = 10000;
+    std::vector<task_completion_event<int>> events(count);
+    std::vector<task<int>> tasks;
+    for (auto &tce : events)
+    {
+        tasks.push_back(create_task(tce));
+    }
+
+    auto any = when_any(tasks.begin(), tasks.end());
+    events[1234].set(42);
+    auto result = any.get();
+    VERIFY_ARE_EQUAL(42, result.first);
+    VERIFY_ARE_EQUAL(1234u, result.second);
+
+    // Tasks completing after the winner are ignored.
+    for (auto &tce : events)
+    {
+        tce.set(0);
+    }
+    VERIFY_ARE_EQUAL(1234u, any.get().second);
+}
+
+#if !defined(_WIN32)
+TEST(TestPooledAllocationReusesBlocks)
+{
+    // Sizes in the same class share a free list, so a freed block is handed out again by the same thread.
+    void *first = pplx::details::_AllocatePooled(40);
+    pplx::details::_FreePooled(first, 40);
+    void *second = pplx::details::_AllocatePooled(64);
+    VERIFY_ARE_EQUAL(first, second);
+    pplx::details::_FreePooled(second, 64);
+
+    // Blocks too large for the pool go to the heap.
+    void *large = pplx::details::_AllocatePooled(4096);
+    memset(large, 0, 4096);
+    pplx::details::_FreePooled(large, 4096);
+}
+#endif
+
+TEST(TestPooledAllocationAcrossThreads)
+{
+    // Task objects are allocated on one thread and freed on others, including threads which exit afterwards.
+    for (int round = 0; round < 4; ++round)
+    {
+        std::vector<task<int>> tasks;
+        std::thread producer([&tasks]()
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                task_completion_event<int> tce;
+                tasks.push_back(create_task(tce).then([](int n) { return n + 1; }));
+                tce.set(i);
+            }
+        });
+        producer.join();
+
+        int sum = 0;
+        for (auto &t : tasks)
+        {
+            sum += t.get();
+        }
+        VERIFY_ARE_EQUAL(500500, sum);
+    }
+}
+
+#endif
+
+#if defined(CPPREST_PPLX_COROUTINES)
+
+namespace
+{
+task<int> co_add(task<int> value, int addend)
+{
+    int result = co_await value;
+    co_return result + addend;
+}
+
+task<void> co_throw(task<void> before)
+{
+    co_await before;
+    throw std::invalid_argument("co_throw");
+}
+
+task<int> co_sum(int count)
+{
+    // Awaiting tasks which are already done neither suspends nor grows the stack.
+    int sum = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        sum += co_await task_from_result(i);
+    }
+    co_return sum;
+}
+}
+
+TEST(TestCoroutineAwaitsPendingTask)
+{
+    task_completion_event<int> tce;
+    auto t = co_add(create_task(tce), 2);
+    VERIFY_IS_FALSE(t.is_done());
+    tce.set(40);
+    VERIFY_ARE_EQUAL(42, t.get());
+}
+
+TEST(TestCoroutineAwaitsCompletedTask)
+{
+    auto t = co_add(task_from_result(1), 1);
+    VERIFY_IS_TRUE(t.is_done());
+    VERIFY_ARE_EQUAL(2, t.get());
+    VERIFY_ARE_EQUAL(4950, co_sum(100).get());
+}
+
+TEST(TestCoroutinePropagatesExceptions)
+{
+    VERIFY_THROWS(co_throw(task_from_result()).get(), std::invalid_argument);
+
+    task_completion_event<int> tce;
+    auto t = co_add(create_task(tce), 1);
+    tce.set_exception(std::runtime_error("awaited"));
+    VERIFY_THROWS(t.get(), std::runtime_error);
+}
+
+#endif
+
 #if defined(_WIN32) && (_MSC_VER >= 1700) && (_MSC_VER < 1800)
 
 TEST(PPL_Conversions_basic)
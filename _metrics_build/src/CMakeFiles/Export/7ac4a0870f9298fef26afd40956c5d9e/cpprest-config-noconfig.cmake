@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "cpprest" for configuration ""
+set_property(TARGET cpprest APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(cpprest PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libcpprest.so.2.9"
+  IMPORTED_SONAME_NOCONFIG "libcpprest.so.2.9"
+  )
+
+list(APPEND _cmake_import_check_targets cpprest )
+list(APPEND _cmake_import_check_files_for_cpprest "${_IMPORT_PREFIX}/lib/libcpprest.so.2.9" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
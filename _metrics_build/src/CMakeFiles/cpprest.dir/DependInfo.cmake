@@ -0,0 +1,51 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/src/http/client/http_client.cpp" "src/CMakeFiles/cpprest.dir/http/client/http_client.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/client/http_client.cpp.o.d"
+  "/root/repo/Release/src/http/client/http_client_asio.cpp" "src/CMakeFiles/cpprest.dir/http/client/http_client_asio.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/client/http_client_asio.cpp.o.d"
+  "/root/repo/Release/src/http/client/http_client_msg.cpp" "src/CMakeFiles/cpprest.dir/http/client/http_client_msg.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/client/http_client_msg.cpp.o.d"
+  "/root/repo/Release/src/http/client/x509_cert_utilities.cpp" "src/CMakeFiles/cpprest.dir/http/client/x509_cert_utilities.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/client/x509_cert_utilities.cpp.o.d"
+  "/root/repo/Release/src/http/common/http_helpers.cpp" "src/CMakeFiles/cpprest.dir/http/common/http_helpers.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/common/http_helpers.cpp.o.d"
+  "/root/repo/Release/src/http/common/http_msg.cpp" "src/CMakeFiles/cpprest.dir/http/common/http_msg.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/common/http_msg.cpp.o.d"
+  "/root/repo/Release/src/http/listener/http_listener.cpp" "src/CMakeFiles/cpprest.dir/http/listener/http_listener.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/listener/http_listener.cpp.o.d"
+  "/root/repo/Release/src/http/listener/http_listener_msg.cpp" "src/CMakeFiles/cpprest.dir/http/listener/http_listener_msg.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/listener/http_listener_msg.cpp.o.d"
+  "/root/repo/Release/src/http/listener/http_server_api.cpp" "src/CMakeFiles/cpprest.dir/http/listener/http_server_api.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/listener/http_server_api.cpp.o.d"
+  "/root/repo/Release/src/http/listener/http_server_asio.cpp" "src/CMakeFiles/cpprest.dir/http/listener/http_server_asio.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/listener/http_server_asio.cpp.o.d"
+  "/root/repo/Release/src/http/oauth/oauth1.cpp" "src/CMakeFiles/cpprest.dir/http/oauth/oauth1.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/oauth/oauth1.cpp.o.d"
+  "/root/repo/Release/src/http/oauth/oauth2.cpp" "src/CMakeFiles/cpprest.dir/http/oauth/oauth2.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/http/oauth/oauth2.cpp.o.d"
+  "/root/repo/Release/src/json/json.cpp" "src/CMakeFiles/cpprest.dir/json/json.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/json/json.cpp.o.d"
+  "/root/repo/Release/src/json/json_ndjson.cpp" "src/CMakeFiles/cpprest.dir/json/json_ndjson.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/json/json_ndjson.cpp.o.d"
+  "/root/repo/Release/src/json/json_parsing.cpp" "src/CMakeFiles/cpprest.dir/json/json_parsing.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/json/json_parsing.cpp.o.d"
+  "/root/repo/Release/src/json/json_pointer.cpp" "src/CMakeFiles/cpprest.dir/json/json_pointer.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/json/json_pointer.cpp.o.d"
+  "/root/repo/Release/src/json/json_serialization.cpp" "src/CMakeFiles/cpprest.dir/json/json_serialization.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/json/json_serialization.cpp.o.d"
+  "/root/repo/Release/src/pplx/pplx.cpp" "src/CMakeFiles/cpprest.dir/pplx/pplx.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/pplx/pplx.cpp.o.d"
+  "/root/repo/Release/src/pplx/pplxlinux.cpp" "src/CMakeFiles/cpprest.dir/pplx/pplxlinux.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/pplx/pplxlinux.cpp.o.d"
+  "/root/repo/Release/src/pplx/threadpool.cpp" "src/CMakeFiles/cpprest.dir/pplx/threadpool.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/pplx/threadpool.cpp.o.d"
+  "/root/repo/Release/src/streams/fileio_posix.cpp" "src/CMakeFiles/cpprest.dir/streams/fileio_posix.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/streams/fileio_posix.cpp.o.d"
+  "/root/repo/Release/src/uri/uri.cpp" "src/CMakeFiles/cpprest.dir/uri/uri.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/uri/uri.cpp.o.d"
+  "/root/repo/Release/src/uri/uri_builder.cpp" "src/CMakeFiles/cpprest.dir/uri/uri_builder.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/uri/uri_builder.cpp.o.d"
+  "/root/repo/Release/src/uri/uri_parser.cpp" "src/CMakeFiles/cpprest.dir/uri/uri_parser.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/uri/uri_parser.cpp.o.d"
+  "/root/repo/Release/src/utilities/asyncrt_utils.cpp" "src/CMakeFiles/cpprest.dir/utilities/asyncrt_utils.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/utilities/asyncrt_utils.cpp.o.d"
+  "/root/repo/Release/src/utilities/base64.cpp" "src/CMakeFiles/cpprest.dir/utilities/base64.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/utilities/base64.cpp.o.d"
+  "/root/repo/Release/src/utilities/web_utilities.cpp" "src/CMakeFiles/cpprest.dir/utilities/web_utilities.cpp.o" "gcc" "src/CMakeFiles/cpprest.dir/utilities/web_utilities.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_metrics_build/Binaries/libcpprest.so" "/root/repo/_metrics_build/Binaries/libcpprest.so.2.9"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,64 @@
+file(REMOVE_RECURSE
+  "../Binaries/libcpprest.pdb"
+  "../Binaries/libcpprest.so"
+  "../Binaries/libcpprest.so.2.9"
+  "CMakeFiles/cpprest.dir/http/client/http_client.cpp.o"
+  "CMakeFiles/cpprest.dir/http/client/http_client.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/client/http_client_asio.cpp.o"
+  "CMakeFiles/cpprest.dir/http/client/http_client_asio.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/client/http_client_msg.cpp.o"
+  "CMakeFiles/cpprest.dir/http/client/http_client_msg.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/client/x509_cert_utilities.cpp.o"
+  "CMakeFiles/cpprest.dir/http/client/x509_cert_utilities.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/common/http_helpers.cpp.o"
+  "CMakeFiles/cpprest.dir/http/common/http_helpers.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/common/http_msg.cpp.o"
+  "CMakeFiles/cpprest.dir/http/common/http_msg.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/listener/http_listener.cpp.o"
+  "CMakeFiles/cpprest.dir/http/listener/http_listener.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/listener/http_listener_msg.cpp.o"
+  "CMakeFiles/cpprest.dir/http/listener/http_listener_msg.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/listener/http_server_api.cpp.o"
+  "CMakeFiles/cpprest.dir/http/listener/http_server_api.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/listener/http_server_asio.cpp.o"
+  "CMakeFiles/cpprest.dir/http/listener/http_server_asio.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/oauth/oauth1.cpp.o"
+  "CMakeFiles/cpprest.dir/http/oauth/oauth1.cpp.o.d"
+  "CMakeFiles/cpprest.dir/http/oauth/oauth2.cpp.o"
+  "CMakeFiles/cpprest.dir/http/oauth/oauth2.cpp.o.d"
+  "CMakeFiles/cpprest.dir/json/json.cpp.o"
+  "CMakeFiles/cpprest.dir/json/json.cpp.o.d"
+  "CMakeFiles/cpprest.dir/json/json_ndjson.cpp.o"
+  "CMakeFiles/cpprest.dir/json/json_ndjson.cpp.o.d"
+  "CMakeFiles/cpprest.dir/json/json_parsing.cpp.o"
+  "CMakeFiles/cpprest.dir/json/json_parsing.cpp.o.d"
+  "CMakeFiles/cpprest.dir/json/json_pointer.cpp.o"
+  "CMakeFiles/cpprest.dir/json/json_pointer.cpp.o.d"
+  "CMakeFiles/cpprest.dir/json/json_serialization.cpp.o"
+  "CMakeFiles/cpprest.dir/json/json_serialization.cpp.o.d"
+  "CMakeFiles/cpprest.dir/pplx/pplx.cpp.o"
+  "CMakeFiles/cpprest.dir/pplx/pplx.cpp.o.d"
+  "CMakeFiles/cpprest.dir/pplx/pplxlinux.cpp.o"
+  "CMakeFiles/cpprest.dir/pplx/pplxlinux.cpp.o.d"
+  "CMakeFiles/cpprest.dir/pplx/threadpool.cpp.o"
+  "CMakeFiles/cpprest.dir/pplx/threadpool.cpp.o.d"
+  "CMakeFiles/cpprest.dir/streams/fileio_posix.cpp.o"
+  "CMakeFiles/cpprest.dir/streams/fileio_posix.cpp.o.d"
+  "CMakeFiles/cpprest.dir/uri/uri.cpp.o"
+  "CMakeFiles/cpprest.dir/uri/uri.cpp.o.d"
+  "CMakeFiles/cpprest.dir/uri/uri_builder.cpp.o"
+  "CMakeFiles/cpprest.dir/uri/uri_builder.cpp.o.d"
+  "CMakeFiles/cpprest.dir/uri/uri_parser.cpp.o"
+  "CMakeFiles/cpprest.dir/uri/uri_parser.cpp.o.d"
+  "CMakeFiles/cpprest.dir/utilities/asyncrt_utils.cpp.o"
+  "CMakeFiles/cpprest.dir/utilities/asyncrt_utils.cpp.o.d"
+  "CMakeFiles/cpprest.dir/utilities/base64.cpp.o"
+  "CMakeFiles/cpprest.dir/utilities/base64.cpp.o.d"
+  "CMakeFiles/cpprest.dir/utilities/web_utilities.cpp.o"
+  "CMakeFiles/cpprest.dir/utilities/web_utilities.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpprest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
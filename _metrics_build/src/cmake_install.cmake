@@ -0,0 +1,165 @@
+# Install script for directory: /root/repo/Release/src
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so.2.9" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so.2.9")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so.2.9"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_metrics_build/Binaries/libcpprest.so.2.9")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so.2.9" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so.2.9")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so.2.9")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_metrics_build/Binaries/libcpprest.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libcpprest.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/cpprest" TYPE FILE FILES
+    "/root/repo/Release/src/../include/cpprest/astreambuf.h"
+    "/root/repo/Release/src/../include/cpprest/asyncrt_utils.h"
+    "/root/repo/Release/src/../include/cpprest/base_uri.h"
+    "/root/repo/Release/src/../include/cpprest/containerstream.h"
+    "/root/repo/Release/src/../include/cpprest/filestream.h"
+    "/root/repo/Release/src/../include/cpprest/http_client.h"
+    "/root/repo/Release/src/../include/cpprest/http_headers.h"
+    "/root/repo/Release/src/../include/cpprest/http_listener.h"
+    "/root/repo/Release/src/../include/cpprest/http_msg.h"
+    "/root/repo/Release/src/../include/cpprest/interopstream.h"
+    "/root/repo/Release/src/../include/cpprest/json.h"
+    "/root/repo/Release/src/../include/cpprest/json_binding.h"
+    "/root/repo/Release/src/../include/cpprest/json_ndjson.h"
+    "/root/repo/Release/src/../include/cpprest/json_pointer.h"
+    "/root/repo/Release/src/../include/cpprest/json_reader.h"
+    "/root/repo/Release/src/../include/cpprest/json_writer.h"
+    "/root/repo/Release/src/../include/cpprest/oauth1.h"
+    "/root/repo/Release/src/../include/cpprest/oauth2.h"
+    "/root/repo/Release/src/../include/cpprest/producerconsumerstream.h"
+    "/root/repo/Release/src/../include/cpprest/rawptrstream.h"
+    "/root/repo/Release/src/../include/cpprest/streams.h"
+    "/root/repo/Release/src/../include/cpprest/uri.h"
+    "/root/repo/Release/src/../include/cpprest/uri_builder.h"
+    "/root/repo/Release/src/../include/cpprest/version.h"
+    "/root/repo/Release/src/../include/cpprest/ws_client.h"
+    "/root/repo/Release/src/../include/cpprest/ws_msg.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/pplx" TYPE FILE FILES
+    "/root/repo/Release/src/../include/pplx/pplx.h"
+    "/root/repo/Release/src/../include/pplx/pplxawait.h"
+    "/root/repo/Release/src/../include/pplx/pplxcancellation_token.h"
+    "/root/repo/Release/src/../include/pplx/pplxconv.h"
+    "/root/repo/Release/src/../include/pplx/pplxinterface.h"
+    "/root/repo/Release/src/../include/pplx/pplxlinux.h"
+    "/root/repo/Release/src/../include/pplx/pplxmetrics.h"
+    "/root/repo/Release/src/../include/pplx/pplxtasks.h"
+    "/root/repo/Release/src/../include/pplx/pplxwin.h"
+    "/root/repo/Release/src/../include/pplx/threadpool.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/cpprest/details" TYPE FILE FILES
+    "/root/repo/Release/src/../include/cpprest/details/SafeInt3.hpp"
+    "/root/repo/Release/src/../include/cpprest/details/basic_types.h"
+    "/root/repo/Release/src/../include/cpprest/details/cpprest_compat.h"
+    "/root/repo/Release/src/../include/cpprest/details/fileio.h"
+    "/root/repo/Release/src/../include/cpprest/details/http_constants.dat"
+    "/root/repo/Release/src/../include/cpprest/details/http_helpers.h"
+    "/root/repo/Release/src/../include/cpprest/details/http_server.h"
+    "/root/repo/Release/src/../include/cpprest/details/http_server_api.h"
+    "/root/repo/Release/src/../include/cpprest/details/http_server_asio.h"
+    "/root/repo/Release/src/../include/cpprest/details/http_server_httpsys.h"
+    "/root/repo/Release/src/../include/cpprest/details/nosal.h"
+    "/root/repo/Release/src/../include/cpprest/details/resource.h"
+    "/root/repo/Release/src/../include/cpprest/details/uri_parser.h"
+    "/root/repo/Release/src/../include/cpprest/details/web_utilities.h"
+    "/root/repo/Release/src/../include/cpprest/details/x509_cert_utilities.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cpprest/cpprest-config.cmake")
+    file(DIFFERENT _cmake_export_file_changed FILES
+         "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cpprest/cpprest-config.cmake"
+         "/root/repo/_metrics_build/src/CMakeFiles/Export/7ac4a0870f9298fef26afd40956c5d9e/cpprest-config.cmake")
+    if(_cmake_export_file_changed)
+      file(GLOB _cmake_old_config_files "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cpprest/cpprest-config-*.cmake")
+      if(_cmake_old_config_files)
+        string(REPLACE ";" ", " _cmake_old_config_files_text "${_cmake_old_config_files}")
+        message(STATUS "Old export file \"$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cpprest/cpprest-config.cmake\" will be replaced.  Removing files [${_cmake_old_config_files_text}].")
+        unset(_cmake_old_config_files_text)
+        file(REMOVE ${_cmake_old_config_files})
+      endif()
+      unset(_cmake_old_config_files)
+    endif()
+    unset(_cmake_export_file_changed)
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cpprest" TYPE FILE FILES "/root/repo/_metrics_build/src/CMakeFiles/Export/7ac4a0870f9298fef26afd40956c5d9e/cpprest-config.cmake")
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^()$")
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cpprest" TYPE FILE FILES "/root/repo/_metrics_build/src/CMakeFiles/Export/7ac4a0870f9298fef26afd40956c5d9e/cpprest-config-noconfig.cmake")
+  endif()
+endif()
+
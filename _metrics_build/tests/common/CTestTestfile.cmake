@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Release/tests/common
+# Build directory: /root/repo/_metrics_build/tests/common
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("utilities")
+subdirs("UnitTestpp")
+subdirs("TestRunner")
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/common/TestRunner/test_module_loader.cpp" "tests/common/TestRunner/CMakeFiles/test_runner.dir/test_module_loader.cpp.o" "gcc" "tests/common/TestRunner/CMakeFiles/test_runner.dir/test_module_loader.cpp.o.d"
+  "/root/repo/Release/tests/common/TestRunner/test_runner.cpp" "tests/common/TestRunner/CMakeFiles/test_runner.dir/test_runner.cpp.o" "gcc" "tests/common/TestRunner/CMakeFiles/test_runner.dir/test_runner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_metrics_build/tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
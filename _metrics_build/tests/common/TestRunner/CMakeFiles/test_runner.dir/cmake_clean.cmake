@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../Binaries/test_runner"
+  "../../../Binaries/test_runner.pdb"
+  "CMakeFiles/test_runner.dir/test_module_loader.cpp.o"
+  "CMakeFiles/test_runner.dir/test_module_loader.cpp.o.d"
+  "CMakeFiles/test_runner.dir/test_runner.cpp.o"
+  "CMakeFiles/test_runner.dir/test_runner.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_runner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
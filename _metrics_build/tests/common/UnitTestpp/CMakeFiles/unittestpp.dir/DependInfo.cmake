@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/common/UnitTestpp/src/AssertException.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/AssertException.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/AssertException.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/CompositeTestReporter.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/CompositeTestReporter.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/CompositeTestReporter.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/CurrentTest.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/CurrentTest.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/CurrentTest.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/DeferredTestReporter.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/DeferredTestReporter.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/DeferredTestReporter.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/DeferredTestResult.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/DeferredTestResult.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/DeferredTestResult.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/GlobalSettings.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/GlobalSettings.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/GlobalSettings.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/MemoryOutStream.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/MemoryOutStream.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/MemoryOutStream.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/Posix/SignalTranslator.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/Posix/SignalTranslator.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/Posix/SignalTranslator.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/Posix/TimeHelpers.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/Posix/TimeHelpers.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/Posix/TimeHelpers.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/ReportAssert.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/ReportAssert.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/ReportAssert.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/Test.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/Test.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/Test.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/TestDetails.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestDetails.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestDetails.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/TestList.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestList.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestList.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/TestReporter.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestReporter.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestReporter.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/TestReporterStdout.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestReporterStdout.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestReporterStdout.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/TestResults.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestResults.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestResults.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/TestRunner.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestRunner.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/TestRunner.cpp.o.d"
+  "/root/repo/Release/tests/common/UnitTestpp/src/XmlTestReporter.cpp" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/XmlTestReporter.cpp.o" "gcc" "tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/src/XmlTestReporter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "../../../Binaries/libunittestpp.pdb"
+  "../../../Binaries/libunittestpp.so"
+  "CMakeFiles/unittestpp.dir/src/AssertException.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/AssertException.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/CompositeTestReporter.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/CompositeTestReporter.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/CurrentTest.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/CurrentTest.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/DeferredTestReporter.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/DeferredTestReporter.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/DeferredTestResult.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/DeferredTestResult.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/GlobalSettings.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/GlobalSettings.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/MemoryOutStream.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/MemoryOutStream.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/Posix/SignalTranslator.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/Posix/SignalTranslator.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/Posix/TimeHelpers.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/Posix/TimeHelpers.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/ReportAssert.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/ReportAssert.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/Test.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/Test.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/TestDetails.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/TestDetails.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/TestList.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/TestList.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/TestReporter.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/TestReporter.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/TestReporterStdout.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/TestReporterStdout.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/TestResults.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/TestResults.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/TestRunner.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/TestRunner.cpp.o.d"
+  "CMakeFiles/unittestpp.dir/src/XmlTestReporter.cpp.o"
+  "CMakeFiles/unittestpp.dir/src/XmlTestReporter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unittestpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
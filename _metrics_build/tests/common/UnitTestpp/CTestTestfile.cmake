@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Release/tests/common/UnitTestpp
+# Build directory: /root/repo/_metrics_build/tests/common/UnitTestpp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
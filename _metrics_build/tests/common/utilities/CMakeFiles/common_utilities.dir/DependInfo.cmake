@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/common/utilities/os_utilities.cpp" "tests/common/utilities/CMakeFiles/common_utilities.dir/os_utilities.cpp.o" "gcc" "tests/common/utilities/CMakeFiles/common_utilities.dir/os_utilities.cpp.o.d"
+  "/root/repo/Release/tests/common/utilities/stdafx.cpp" "tests/common/utilities/CMakeFiles/common_utilities.dir/stdafx.cpp.o" "gcc" "tests/common/utilities/CMakeFiles/common_utilities.dir/stdafx.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_metrics_build/src/CMakeFiles/cpprest.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../Binaries/libcommon_utilities.pdb"
+  "../../../Binaries/libcommon_utilities.so"
+  "CMakeFiles/common_utilities.dir/os_utilities.cpp.o"
+  "CMakeFiles/common_utilities.dir/os_utilities.cpp.o.d"
+  "CMakeFiles/common_utilities.dir/stdafx.cpp.o"
+  "CMakeFiles/common_utilities.dir/stdafx.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/common_utilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Release/tests/functional
+# Build directory: /root/repo/_metrics_build/tests/functional
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("http")
+subdirs("json")
+subdirs("pplx")
+subdirs("streams")
+subdirs("uri")
+subdirs("utils")
+subdirs("websockets")
@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/functional/http/client/authentication_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/authentication_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/authentication_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/building_request_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/building_request_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/building_request_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/client_construction.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/client_construction.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/client_construction.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/connections_and_errors.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/connections_and_errors.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/connections_and_errors.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/header_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/header_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/header_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/http_client_fuzz_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/http_client_fuzz_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/http_client_fuzz_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/http_client_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/http_client_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/http_client_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/http_methods_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/http_methods_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/http_methods_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/multiple_requests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/multiple_requests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/multiple_requests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/oauth1_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/oauth1_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/oauth1_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/oauth2_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/oauth2_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/oauth2_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/outside_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/outside_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/outside_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/pipeline_stage_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/pipeline_stage_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/pipeline_stage_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/progress_handler_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/progress_handler_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/progress_handler_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/proxy_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/proxy_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/proxy_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/request_helper_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/request_helper_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/request_helper_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/request_stream_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/request_stream_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/request_stream_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/request_uri_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/request_uri_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/request_uri_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/response_extract_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/response_extract_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/response_extract_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/response_stream_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/response_stream_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/response_stream_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/status_code_reason_phrase_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/status_code_reason_phrase_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/status_code_reason_phrase_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/stdafx.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/stdafx.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/stdafx.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/client/to_string_tests.cpp" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/to_string_tests.cpp.o" "gcc" "tests/functional/http/client/CMakeFiles/httpclient_test.dir/to_string_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_metrics_build/tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/utilities/CMakeFiles/common_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/src/CMakeFiles/cpprest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
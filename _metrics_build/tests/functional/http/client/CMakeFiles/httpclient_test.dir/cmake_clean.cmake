@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "../../../../Binaries/libhttpclient_test.pdb"
+  "../../../../Binaries/libhttpclient_test.so"
+  "CMakeFiles/httpclient_test.dir/authentication_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/authentication_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/building_request_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/building_request_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/client_construction.cpp.o"
+  "CMakeFiles/httpclient_test.dir/client_construction.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/connections_and_errors.cpp.o"
+  "CMakeFiles/httpclient_test.dir/connections_and_errors.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/header_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/header_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/http_client_fuzz_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/http_client_fuzz_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/http_client_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/http_client_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/http_methods_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/http_methods_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/multiple_requests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/multiple_requests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/oauth1_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/oauth1_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/oauth2_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/oauth2_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/outside_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/outside_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/pipeline_stage_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/pipeline_stage_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/progress_handler_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/progress_handler_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/proxy_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/proxy_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/request_helper_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/request_helper_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/request_stream_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/request_stream_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/request_uri_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/request_uri_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/response_extract_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/response_extract_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/response_stream_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/response_stream_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/status_code_reason_phrase_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/status_code_reason_phrase_tests.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/stdafx.cpp.o"
+  "CMakeFiles/httpclient_test.dir/stdafx.cpp.o.d"
+  "CMakeFiles/httpclient_test.dir/to_string_tests.cpp.o"
+  "CMakeFiles/httpclient_test.dir/to_string_tests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httpclient_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
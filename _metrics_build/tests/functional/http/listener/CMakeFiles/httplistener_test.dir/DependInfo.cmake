@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/functional/http/listener/building_response_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/building_response_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/building_response_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/connections_and_errors.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/connections_and_errors.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/connections_and_errors.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/header_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/header_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/header_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/listener_construction_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/listener_construction_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/listener_construction_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/reply_helper_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/reply_helper_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/reply_helper_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/request_extract_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/request_extract_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/request_extract_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/request_handler_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/request_handler_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/request_handler_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/request_relative_uri_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/request_relative_uri_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/request_relative_uri_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/request_stream_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/request_stream_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/request_stream_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/requests_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/requests_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/requests_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/response_stream_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/response_stream_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/response_stream_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/status_code_reason_phrase_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/status_code_reason_phrase_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/status_code_reason_phrase_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/stdafx.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/stdafx.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/stdafx.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/listener/to_string_tests.cpp" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/to_string_tests.cpp.o" "gcc" "tests/functional/http/listener/CMakeFiles/httplistener_test.dir/to_string_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_metrics_build/tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/utilities/CMakeFiles/common_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/src/CMakeFiles/cpprest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
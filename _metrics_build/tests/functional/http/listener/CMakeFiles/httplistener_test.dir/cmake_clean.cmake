@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "../../../../Binaries/libhttplistener_test.pdb"
+  "../../../../Binaries/libhttplistener_test.so"
+  "CMakeFiles/httplistener_test.dir/building_response_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/building_response_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/connections_and_errors.cpp.o"
+  "CMakeFiles/httplistener_test.dir/connections_and_errors.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/header_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/header_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/listener_construction_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/listener_construction_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/reply_helper_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/reply_helper_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/request_extract_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/request_extract_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/request_handler_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/request_handler_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/request_relative_uri_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/request_relative_uri_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/request_stream_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/request_stream_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/requests_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/requests_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/response_stream_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/response_stream_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/status_code_reason_phrase_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/status_code_reason_phrase_tests.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/stdafx.cpp.o"
+  "CMakeFiles/httplistener_test.dir/stdafx.cpp.o.d"
+  "CMakeFiles/httplistener_test.dir/to_string_tests.cpp.o"
+  "CMakeFiles/httplistener_test.dir/to_string_tests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httplistener_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
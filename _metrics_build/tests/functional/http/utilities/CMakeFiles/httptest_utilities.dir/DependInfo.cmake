@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/functional/http/utilities/http_asserts.cpp" "tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/http_asserts.cpp.o" "gcc" "tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/http_asserts.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/utilities/test_http_client.cpp" "tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/test_http_client.cpp.o" "gcc" "tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/test_http_client.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/utilities/test_http_server.cpp" "tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/test_http_server.cpp.o" "gcc" "tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/test_http_server.cpp.o.d"
+  "/root/repo/Release/tests/functional/http/utilities/test_server_utilities.cpp" "tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/test_server_utilities.cpp.o" "gcc" "tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/test_server_utilities.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_metrics_build/tests/common/utilities/CMakeFiles/common_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/src/CMakeFiles/cpprest.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
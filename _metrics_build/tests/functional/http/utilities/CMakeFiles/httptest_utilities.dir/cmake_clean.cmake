@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../../Binaries/libhttptest_utilities.pdb"
+  "../../../../Binaries/libhttptest_utilities.so"
+  "CMakeFiles/httptest_utilities.dir/http_asserts.cpp.o"
+  "CMakeFiles/httptest_utilities.dir/http_asserts.cpp.o.d"
+  "CMakeFiles/httptest_utilities.dir/test_http_client.cpp.o"
+  "CMakeFiles/httptest_utilities.dir/test_http_client.cpp.o.d"
+  "CMakeFiles/httptest_utilities.dir/test_http_server.cpp.o"
+  "CMakeFiles/httptest_utilities.dir/test_http_server.cpp.o.d"
+  "CMakeFiles/httptest_utilities.dir/test_server_utilities.cpp.o"
+  "CMakeFiles/httptest_utilities.dir/test_server_utilities.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httptest_utilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/functional/json/binding_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/binding_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/binding_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/construction_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/construction_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/construction_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/fuzz_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/fuzz_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/fuzz_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/iterator_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/iterator_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/iterator_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/json_numbers_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/json_numbers_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/json_numbers_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/ndjson_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/ndjson_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/ndjson_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/negative_parsing_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/negative_parsing_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/negative_parsing_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/parsing_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/parsing_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/parsing_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/pointer_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/pointer_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/pointer_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/stdafx.cpp" "tests/functional/json/CMakeFiles/json_test.dir/stdafx.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/stdafx.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/to_as_and_operators_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/to_as_and_operators_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/to_as_and_operators_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/json/writer_tests.cpp" "tests/functional/json/CMakeFiles/json_test.dir/writer_tests.cpp.o" "gcc" "tests/functional/json/CMakeFiles/json_test.dir/writer_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_metrics_build/tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/utilities/CMakeFiles/common_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/src/CMakeFiles/cpprest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
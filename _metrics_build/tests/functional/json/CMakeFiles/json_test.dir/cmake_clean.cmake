@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "../../../Binaries/libjson_test.pdb"
+  "../../../Binaries/libjson_test.so"
+  "CMakeFiles/json_test.dir/binding_tests.cpp.o"
+  "CMakeFiles/json_test.dir/binding_tests.cpp.o.d"
+  "CMakeFiles/json_test.dir/construction_tests.cpp.o"
+  "CMakeFiles/json_test.dir/construction_tests.cpp.o.d"
+  "CMakeFiles/json_test.dir/fuzz_tests.cpp.o"
+  "CMakeFiles/json_test.dir/fuzz_tests.cpp.o.d"
+  "CMakeFiles/json_test.dir/iterator_tests.cpp.o"
+  "CMakeFiles/json_test.dir/iterator_tests.cpp.o.d"
+  "CMakeFiles/json_test.dir/json_numbers_tests.cpp.o"
+  "CMakeFiles/json_test.dir/json_numbers_tests.cpp.o.d"
+  "CMakeFiles/json_test.dir/ndjson_tests.cpp.o"
+  "CMakeFiles/json_test.dir/ndjson_tests.cpp.o.d"
+  "CMakeFiles/json_test.dir/negative_parsing_tests.cpp.o"
+  "CMakeFiles/json_test.dir/negative_parsing_tests.cpp.o.d"
+  "CMakeFiles/json_test.dir/parsing_tests.cpp.o"
+  "CMakeFiles/json_test.dir/parsing_tests.cpp.o.d"
+  "CMakeFiles/json_test.dir/pointer_tests.cpp.o"
+  "CMakeFiles/json_test.dir/pointer_tests.cpp.o.d"
+  "CMakeFiles/json_test.dir/stdafx.cpp.o"
+  "CMakeFiles/json_test.dir/stdafx.cpp.o.d"
+  "CMakeFiles/json_test.dir/to_as_and_operators_tests.cpp.o"
+  "CMakeFiles/json_test.dir/to_as_and_operators_tests.cpp.o.d"
+  "CMakeFiles/json_test.dir/writer_tests.cpp.o"
+  "CMakeFiles/json_test.dir/writer_tests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/json_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
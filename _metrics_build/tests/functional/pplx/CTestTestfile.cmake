@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Release/tests/functional/pplx
+# Build directory: /root/repo/_metrics_build/tests/functional/pplx
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("pplx_test")
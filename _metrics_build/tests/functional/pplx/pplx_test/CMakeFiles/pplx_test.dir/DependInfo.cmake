@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/functional/pplx/pplx_test/pplx_op_test.cpp" "tests/functional/pplx/pplx_test/CMakeFiles/pplx_test.dir/pplx_op_test.cpp.o" "gcc" "tests/functional/pplx/pplx_test/CMakeFiles/pplx_test.dir/pplx_op_test.cpp.o.d"
+  "/root/repo/Release/tests/functional/pplx/pplx_test/pplx_scheduler_tests.cpp" "tests/functional/pplx/pplx_test/CMakeFiles/pplx_test.dir/pplx_scheduler_tests.cpp.o" "gcc" "tests/functional/pplx/pplx_test/CMakeFiles/pplx_test.dir/pplx_scheduler_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/pplx/pplx_test/pplx_task_options.cpp" "tests/functional/pplx/pplx_test/CMakeFiles/pplx_test.dir/pplx_task_options.cpp.o" "gcc" "tests/functional/pplx/pplx_test/CMakeFiles/pplx_test.dir/pplx_task_options.cpp.o.d"
+  "/root/repo/Release/tests/functional/pplx/pplx_test/pplxtask_tests.cpp" "tests/functional/pplx/pplx_test/CMakeFiles/pplx_test.dir/pplxtask_tests.cpp.o" "gcc" "tests/functional/pplx/pplx_test/CMakeFiles/pplx_test.dir/pplxtask_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/pplx/pplx_test/stdafx.cpp" "tests/functional/pplx/pplx_test/CMakeFiles/pplx_test.dir/stdafx.cpp.o" "gcc" "tests/functional/pplx/pplx_test/CMakeFiles/pplx_test.dir/stdafx.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_metrics_build/tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/utilities/CMakeFiles/common_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/src/CMakeFiles/cpprest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
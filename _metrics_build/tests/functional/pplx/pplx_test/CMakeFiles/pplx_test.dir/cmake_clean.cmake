@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../../Binaries/libpplx_test.pdb"
+  "../../../../Binaries/libpplx_test.so"
+  "CMakeFiles/pplx_test.dir/pplx_op_test.cpp.o"
+  "CMakeFiles/pplx_test.dir/pplx_op_test.cpp.o.d"
+  "CMakeFiles/pplx_test.dir/pplx_scheduler_tests.cpp.o"
+  "CMakeFiles/pplx_test.dir/pplx_scheduler_tests.cpp.o.d"
+  "CMakeFiles/pplx_test.dir/pplx_task_options.cpp.o"
+  "CMakeFiles/pplx_test.dir/pplx_task_options.cpp.o.d"
+  "CMakeFiles/pplx_test.dir/pplxtask_tests.cpp.o"
+  "CMakeFiles/pplx_test.dir/pplxtask_tests.cpp.o.d"
+  "CMakeFiles/pplx_test.dir/stdafx.cpp.o"
+  "CMakeFiles/pplx_test.dir/stdafx.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pplx_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
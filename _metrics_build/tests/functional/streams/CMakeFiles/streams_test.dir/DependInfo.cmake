@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/functional/streams/fstreambuf_tests.cpp" "tests/functional/streams/CMakeFiles/streams_test.dir/fstreambuf_tests.cpp.o" "gcc" "tests/functional/streams/CMakeFiles/streams_test.dir/fstreambuf_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/streams/fuzz_tests.cpp" "tests/functional/streams/CMakeFiles/streams_test.dir/fuzz_tests.cpp.o" "gcc" "tests/functional/streams/CMakeFiles/streams_test.dir/fuzz_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/streams/istream_tests.cpp" "tests/functional/streams/CMakeFiles/streams_test.dir/istream_tests.cpp.o" "gcc" "tests/functional/streams/CMakeFiles/streams_test.dir/istream_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/streams/memstream_tests.cpp" "tests/functional/streams/CMakeFiles/streams_test.dir/memstream_tests.cpp.o" "gcc" "tests/functional/streams/CMakeFiles/streams_test.dir/memstream_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/streams/ostream_tests.cpp" "tests/functional/streams/CMakeFiles/streams_test.dir/ostream_tests.cpp.o" "gcc" "tests/functional/streams/CMakeFiles/streams_test.dir/ostream_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/streams/stdafx.cpp" "tests/functional/streams/CMakeFiles/streams_test.dir/stdafx.cpp.o" "gcc" "tests/functional/streams/CMakeFiles/streams_test.dir/stdafx.cpp.o.d"
+  "/root/repo/Release/tests/functional/streams/stdstream_tests.cpp" "tests/functional/streams/CMakeFiles/streams_test.dir/stdstream_tests.cpp.o" "gcc" "tests/functional/streams/CMakeFiles/streams_test.dir/stdstream_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_metrics_build/tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/utilities/CMakeFiles/common_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/src/CMakeFiles/cpprest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
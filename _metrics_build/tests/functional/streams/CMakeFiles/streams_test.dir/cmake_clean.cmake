@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../../Binaries/libstreams_test.pdb"
+  "../../../Binaries/libstreams_test.so"
+  "CMakeFiles/streams_test.dir/fstreambuf_tests.cpp.o"
+  "CMakeFiles/streams_test.dir/fstreambuf_tests.cpp.o.d"
+  "CMakeFiles/streams_test.dir/fuzz_tests.cpp.o"
+  "CMakeFiles/streams_test.dir/fuzz_tests.cpp.o.d"
+  "CMakeFiles/streams_test.dir/istream_tests.cpp.o"
+  "CMakeFiles/streams_test.dir/istream_tests.cpp.o.d"
+  "CMakeFiles/streams_test.dir/memstream_tests.cpp.o"
+  "CMakeFiles/streams_test.dir/memstream_tests.cpp.o.d"
+  "CMakeFiles/streams_test.dir/ostream_tests.cpp.o"
+  "CMakeFiles/streams_test.dir/ostream_tests.cpp.o.d"
+  "CMakeFiles/streams_test.dir/stdafx.cpp.o"
+  "CMakeFiles/streams_test.dir/stdafx.cpp.o.d"
+  "CMakeFiles/streams_test.dir/stdstream_tests.cpp.o"
+  "CMakeFiles/streams_test.dir/stdstream_tests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/streams_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/functional/uri/accessor_tests.cpp" "tests/functional/uri/CMakeFiles/uri_test.dir/accessor_tests.cpp.o" "gcc" "tests/functional/uri/CMakeFiles/uri_test.dir/accessor_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/uri/combining_tests.cpp" "tests/functional/uri/CMakeFiles/uri_test.dir/combining_tests.cpp.o" "gcc" "tests/functional/uri/CMakeFiles/uri_test.dir/combining_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/uri/constructor_tests.cpp" "tests/functional/uri/CMakeFiles/uri_test.dir/constructor_tests.cpp.o" "gcc" "tests/functional/uri/CMakeFiles/uri_test.dir/constructor_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/uri/conversions_tests.cpp" "tests/functional/uri/CMakeFiles/uri_test.dir/conversions_tests.cpp.o" "gcc" "tests/functional/uri/CMakeFiles/uri_test.dir/conversions_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/uri/diagnostic_tests.cpp" "tests/functional/uri/CMakeFiles/uri_test.dir/diagnostic_tests.cpp.o" "gcc" "tests/functional/uri/CMakeFiles/uri_test.dir/diagnostic_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/uri/encoding_tests.cpp" "tests/functional/uri/CMakeFiles/uri_test.dir/encoding_tests.cpp.o" "gcc" "tests/functional/uri/CMakeFiles/uri_test.dir/encoding_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/uri/operator_tests.cpp" "tests/functional/uri/CMakeFiles/uri_test.dir/operator_tests.cpp.o" "gcc" "tests/functional/uri/CMakeFiles/uri_test.dir/operator_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/uri/splitting_tests.cpp" "tests/functional/uri/CMakeFiles/uri_test.dir/splitting_tests.cpp.o" "gcc" "tests/functional/uri/CMakeFiles/uri_test.dir/splitting_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/uri/stdafx.cpp" "tests/functional/uri/CMakeFiles/uri_test.dir/stdafx.cpp.o" "gcc" "tests/functional/uri/CMakeFiles/uri_test.dir/stdafx.cpp.o.d"
+  "/root/repo/Release/tests/functional/uri/uri_builder_tests.cpp" "tests/functional/uri/CMakeFiles/uri_test.dir/uri_builder_tests.cpp.o" "gcc" "tests/functional/uri/CMakeFiles/uri_test.dir/uri_builder_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_metrics_build/tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/utilities/CMakeFiles/common_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/src/CMakeFiles/cpprest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
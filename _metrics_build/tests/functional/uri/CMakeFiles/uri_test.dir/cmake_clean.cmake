@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../../Binaries/liburi_test.pdb"
+  "../../../Binaries/liburi_test.so"
+  "CMakeFiles/uri_test.dir/accessor_tests.cpp.o"
+  "CMakeFiles/uri_test.dir/accessor_tests.cpp.o.d"
+  "CMakeFiles/uri_test.dir/combining_tests.cpp.o"
+  "CMakeFiles/uri_test.dir/combining_tests.cpp.o.d"
+  "CMakeFiles/uri_test.dir/constructor_tests.cpp.o"
+  "CMakeFiles/uri_test.dir/constructor_tests.cpp.o.d"
+  "CMakeFiles/uri_test.dir/conversions_tests.cpp.o"
+  "CMakeFiles/uri_test.dir/conversions_tests.cpp.o.d"
+  "CMakeFiles/uri_test.dir/diagnostic_tests.cpp.o"
+  "CMakeFiles/uri_test.dir/diagnostic_tests.cpp.o.d"
+  "CMakeFiles/uri_test.dir/encoding_tests.cpp.o"
+  "CMakeFiles/uri_test.dir/encoding_tests.cpp.o.d"
+  "CMakeFiles/uri_test.dir/operator_tests.cpp.o"
+  "CMakeFiles/uri_test.dir/operator_tests.cpp.o.d"
+  "CMakeFiles/uri_test.dir/splitting_tests.cpp.o"
+  "CMakeFiles/uri_test.dir/splitting_tests.cpp.o.d"
+  "CMakeFiles/uri_test.dir/stdafx.cpp.o"
+  "CMakeFiles/uri_test.dir/stdafx.cpp.o.d"
+  "CMakeFiles/uri_test.dir/uri_builder_tests.cpp.o"
+  "CMakeFiles/uri_test.dir/uri_builder_tests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uri_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
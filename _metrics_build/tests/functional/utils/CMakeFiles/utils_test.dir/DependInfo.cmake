@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Release/tests/functional/utils/base64.cpp" "tests/functional/utils/CMakeFiles/utils_test.dir/base64.cpp.o" "gcc" "tests/functional/utils/CMakeFiles/utils_test.dir/base64.cpp.o.d"
+  "/root/repo/Release/tests/functional/utils/datetime.cpp" "tests/functional/utils/CMakeFiles/utils_test.dir/datetime.cpp.o" "gcc" "tests/functional/utils/CMakeFiles/utils_test.dir/datetime.cpp.o.d"
+  "/root/repo/Release/tests/functional/utils/macro_test.cpp" "tests/functional/utils/CMakeFiles/utils_test.dir/macro_test.cpp.o" "gcc" "tests/functional/utils/CMakeFiles/utils_test.dir/macro_test.cpp.o.d"
+  "/root/repo/Release/tests/functional/utils/nonce_generator_tests.cpp" "tests/functional/utils/CMakeFiles/utils_test.dir/nonce_generator_tests.cpp.o" "gcc" "tests/functional/utils/CMakeFiles/utils_test.dir/nonce_generator_tests.cpp.o.d"
+  "/root/repo/Release/tests/functional/utils/stdafx.cpp" "tests/functional/utils/CMakeFiles/utils_test.dir/stdafx.cpp.o" "gcc" "tests/functional/utils/CMakeFiles/utils_test.dir/stdafx.cpp.o.d"
+  "/root/repo/Release/tests/functional/utils/strings.cpp" "tests/functional/utils/CMakeFiles/utils_test.dir/strings.cpp.o" "gcc" "tests/functional/utils/CMakeFiles/utils_test.dir/strings.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_metrics_build/tests/functional/http/utilities/CMakeFiles/httptest_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/utilities/CMakeFiles/common_utilities.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/tests/common/UnitTestpp/CMakeFiles/unittestpp.dir/DependInfo.cmake"
+  "/root/repo/_metrics_build/src/CMakeFiles/cpprest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
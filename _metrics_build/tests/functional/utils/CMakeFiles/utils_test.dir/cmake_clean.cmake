@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../Binaries/libutils_test.pdb"
+  "../../../Binaries/libutils_test.so"
+  "CMakeFiles/utils_test.dir/base64.cpp.o"
+  "CMakeFiles/utils_test.dir/base64.cpp.o.d"
+  "CMakeFiles/utils_test.dir/datetime.cpp.o"
+  "CMakeFiles/utils_test.dir/datetime.cpp.o.d"
+  "CMakeFiles/utils_test.dir/macro_test.cpp.o"
+  "CMakeFiles/utils_test.dir/macro_test.cpp.o.d"
+  "CMakeFiles/utils_test.dir/nonce_generator_tests.cpp.o"
+  "CMakeFiles/utils_test.dir/nonce_generator_tests.cpp.o.d"
+  "CMakeFiles/utils_test.dir/stdafx.cpp.o"
+  "CMakeFiles/utils_test.dir/stdafx.cpp.o.d"
+  "CMakeFiles/utils_test.dir/strings.cpp.o"
+  "CMakeFiles/utils_test.dir/strings.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
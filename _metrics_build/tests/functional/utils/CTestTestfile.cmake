@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Release/tests/functional/utils
+# Build directory: /root/repo/_metrics_build/tests/functional/utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(utils_test "/root/repo/_metrics_build/Binaries/test_runner" "libutils_test.so")
+set_tests_properties(utils_test PROPERTIES  WORKING_DIRECTORY "/root/repo/_metrics_build/Binaries" _BACKTRACE_TRIPLES "/root/repo/Release/CMakeLists.txt;202;add_test;/root/repo/Release/tests/functional/utils/CMakeLists.txt;10;add_casablanca_test;/root/repo/Release/tests/functional/utils/CMakeLists.txt;0;")